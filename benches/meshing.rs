@@ -0,0 +1,204 @@
+use criterion::{criterion_group, criterion_main, BenchmarkId, Criterion, Throughput};
+use tritet::{Tetgen, Trigen};
+
+/// Deterministic pseudo-random sequence (so all runs see the same clouds)
+struct Lcg(u64);
+
+impl Lcg {
+    fn next_f64(&mut self) -> f64 {
+        self.0 = self.0.wrapping_mul(6364136223846793005).wrapping_add(1442695040888963407);
+        (self.0 >> 11) as f64 / (1u64 << 53) as f64
+    }
+}
+
+/// Generates a random cloud of npoint 2D points in [0, 1] x [0, 1]
+fn cloud_2d(npoint: usize) -> (Vec<f64>, Vec<i32>) {
+    let mut rng = Lcg(123);
+    let coords: Vec<f64> = (0..npoint * 2).map(|_| rng.next_f64()).collect();
+    (coords, vec![0; npoint])
+}
+
+/// Generates a random cloud of npoint 3D points in the unit cube
+fn cloud_3d(npoint: usize) -> (Vec<f64>, Vec<i32>) {
+    let mut rng = Lcg(456);
+    let coords: Vec<f64> = (0..npoint * 3).map(|_| rng.next_f64()).collect();
+    (coords, vec![0; npoint])
+}
+
+/// Builds the PSLG of examples/triangle_mesh_1.rs (face with mouth, eyes, and nostrils)
+fn face_pslg() -> Trigen {
+    let mut trigen = Trigen::new(26, Some(22), Some(1), Some(3)).unwrap();
+    #[rustfmt::skip]
+    let coords = [
+        80.0, 0.0, 100.0, 50.0, 0.0, 100.0, -100.0, 50.0, // outer polyhedron
+        -80.0, 0.0, -100.0, -50.0, 0.0, -100.0, 100.0, -50.0,
+        0.0, -90.0, 80.0, -50.0, 0.0, -10.0, -80.0, -50.0, // mouth
+        -70.0, 50.0, -60.0, 30.0, -10.0, 55.0, -40.0, 55.0, // left eye
+        70.0, 50.0, 60.0, 30.0, 10.0, 55.0, 40.0, 55.0, // right eye
+        -10.0, 25.0, -20.0, -10.0, 10.0, 25.0, 20.0, -10.0, // nostrils
+        -50.0, 0.0, 50.0, 0.0, // dimples
+    ];
+    #[rustfmt::skip]
+    let segments = [
+        0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 0, // outer polyhedron
+        8, 9, 9, 10, 10, 11, 11, 8, // mouth
+        12, 13, 13, 14, 14, 15, 15, 12, // left eye
+        16, 17, 17, 18, 18, 19, 19, 16, // right eye
+        20, 21, 22, 23, // nostrils
+    ];
+    trigen
+        .set_points_batch(&coords, &[0; 26])
+        .unwrap()
+        .set_segments_batch(&segments, &[0; 22])
+        .unwrap()
+        .set_region(0, 1, 0.0, 0.0, None)
+        .unwrap()
+        .set_hole(0, 0.0, -50.0)
+        .unwrap()
+        .set_hole(1, -50.0, 50.0)
+        .unwrap()
+        .set_hole(2, 50.0, 50.0)
+        .unwrap();
+    trigen
+}
+
+/// Builds the unit cube PLC (8 points, 6 quadrilateral facets)
+fn cube_plc() -> Tetgen {
+    let mut tetgen = Tetgen::new(8, Some(vec![4, 4, 4, 4, 4, 4]), None, None).unwrap();
+    #[rustfmt::skip]
+    let coords = [
+        0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 1.0, 1.0, 0.0, 0.0, 1.0, 0.0,
+        0.0, 0.0, 1.0, 1.0, 0.0, 1.0, 1.0, 1.0, 1.0, 0.0, 1.0, 1.0,
+    ];
+    #[rustfmt::skip]
+    let facets = [
+        0, 4, 7, 3, // -x
+        1, 2, 6, 5, // +x
+        0, 1, 5, 4, // -y
+        2, 3, 7, 6, // +y
+        0, 3, 2, 1, // -z
+        4, 5, 6, 7, // +z
+    ];
+    let offsets = [0, 4, 8, 12, 16, 20, 24];
+    tetgen
+        .set_points_batch(&coords, &[0; 8])
+        .unwrap()
+        .set_facets_batch(&offsets, &facets, None)
+        .unwrap();
+    tetgen
+}
+
+/// Delaunay triangulation of random 2D clouds (throughput in cells/sec)
+fn bench_tri_delaunay(c: &mut Criterion) {
+    let mut group = c.benchmark_group("tri_delaunay");
+    group.sample_size(10);
+    for npoint in [1_000, 10_000, 100_000, 1_000_000] {
+        let (coords, markers) = cloud_2d(npoint);
+        // count the cells once, so the throughput can be reported in cells/sec
+        let mut probe = Trigen::new(npoint, None, None, None).unwrap();
+        probe.set_points_batch(&coords, &markers).unwrap();
+        probe.generate_delaunay(false).unwrap();
+        group.throughput(Throughput::Elements(probe.out_ncell() as u64));
+        group.bench_with_input(BenchmarkId::from_parameter(npoint), &npoint, |b, _| {
+            b.iter(|| {
+                let mut trigen = Trigen::new(npoint, None, None, None).unwrap();
+                trigen.set_points_batch(&coords, &markers).unwrap();
+                trigen.generate_delaunay(false).unwrap();
+                trigen.out_ncell()
+            });
+        });
+    }
+    group.finish();
+}
+
+/// Delaunay tetrahedralization of random 3D clouds (throughput in cells/sec)
+fn bench_tet_delaunay(c: &mut Criterion) {
+    let mut group = c.benchmark_group("tet_delaunay");
+    group.sample_size(10);
+    for npoint in [1_000, 10_000, 100_000] {
+        let (coords, markers) = cloud_3d(npoint);
+        let mut probe = Tetgen::new(npoint, None, None, None).unwrap();
+        probe.set_points_batch(&coords, &markers).unwrap();
+        probe.generate_delaunay(false, true).unwrap();
+        group.throughput(Throughput::Elements(probe.out_ncell() as u64));
+        group.bench_with_input(BenchmarkId::from_parameter(npoint), &npoint, |b, _| {
+            b.iter(|| {
+                let mut tetgen = Tetgen::new(npoint, None, None, None).unwrap();
+                tetgen.set_points_batch(&coords, &markers).unwrap();
+                tetgen.generate_delaunay(false, true).unwrap();
+                tetgen.out_ncell()
+            });
+        });
+    }
+    group.finish();
+}
+
+/// Quality meshing of a PSLG with holes and a region at several max-area settings
+fn bench_tri_mesh(c: &mut Criterion) {
+    let mut group = c.benchmark_group("tri_mesh");
+    group.sample_size(10);
+    for max_area in [10.0, 1.0, 0.1] {
+        let mut probe = face_pslg();
+        probe.generate_mesh(false, false, true, Some(max_area), None).unwrap();
+        group.throughput(Throughput::Elements(probe.out_ncell() as u64));
+        group.bench_with_input(BenchmarkId::from_parameter(max_area), &max_area, |b, _| {
+            b.iter(|| {
+                let mut trigen = face_pslg();
+                trigen.generate_mesh(false, false, true, Some(max_area), None).unwrap();
+                trigen.out_ncell()
+            });
+        });
+    }
+    group.finish();
+}
+
+/// Quality meshing of the unit cube PLC at several max-volume settings
+fn bench_tet_mesh(c: &mut Criterion) {
+    let mut group = c.benchmark_group("tet_mesh");
+    group.sample_size(10);
+    for max_volume in [0.01, 0.001, 0.0001] {
+        let mut probe = cube_plc();
+        probe.generate_mesh(false, false, Some(max_volume), None).unwrap();
+        group.throughput(Throughput::Elements(probe.out_ncell() as u64));
+        group.bench_with_input(BenchmarkId::from_parameter(max_volume), &max_volume, |b, _| {
+            b.iter(|| {
+                let mut tetgen = cube_plc();
+                tetgen.generate_mesh(false, false, Some(max_volume), None).unwrap();
+                tetgen.out_ncell()
+            });
+        });
+    }
+    group.finish();
+}
+
+/// Output extraction: reading all cell corners and coordinates back from the FFI layer
+fn bench_output_extraction(c: &mut Criterion) {
+    let mut group = c.benchmark_group("output_extraction");
+    let mut tetgen = cube_plc();
+    tetgen.generate_mesh(false, false, Some(0.0001), None).unwrap();
+    let ncell = tetgen.out_ncell();
+    group.throughput(Throughput::Elements(ncell as u64));
+    group.bench_function("tet_per_cell_calls", |b| {
+        b.iter(|| {
+            let mut sum = 0.0;
+            for index in 0..ncell {
+                for m in 0..4 {
+                    let p = tetgen.out_cell_point(index, m);
+                    sum += tetgen.out_point(p, 0);
+                }
+            }
+            sum
+        });
+    });
+    group.finish();
+}
+
+criterion_group!(
+    benches,
+    bench_tri_delaunay,
+    bench_tet_delaunay,
+    bench_tri_mesh,
+    bench_tet_mesh,
+    bench_output_extraction
+);
+criterion_main!(benches);
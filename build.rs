@@ -1,6 +1,11 @@
 #[cfg(any(target_os = "linux", target_os = "macos"))]
 fn main() {
-    cc::Build::new()
+    let large_indices = std::env::var("CARGO_FEATURE_LARGE_INDICES").is_ok();
+    let mut triangle = cc::Build::new();
+    if large_indices {
+        triangle.define("TRITET_LARGE_INDICES", None);
+    }
+    triangle
         .file("c_code/triangle.c")
         .file("c_code/tricall_report.c")
         .file("c_code/interface_triangle.c")
@@ -9,7 +14,11 @@ fn main() {
         .flag("-Wno-unused-but-set-variable")
         .flag("-Wno-maybe-uninitialized")
         .compile("c_code_interface_triangle");
-    cc::Build::new()
+    let mut tetgen = cc::Build::new();
+    if large_indices {
+        tetgen.define("TRITET_LARGE_INDICES", None);
+    }
+    tetgen
         .cpp(true)
         .file("c_code/predicates.cxx")
         .file("c_code/tetgen.cxx")
@@ -23,13 +32,22 @@ fn main() {
 
 #[cfg(target_os = "windows")]
 fn main() {
-    cc::Build::new()
+    let large_indices = std::env::var("CARGO_FEATURE_LARGE_INDICES").is_ok();
+    let mut triangle = cc::Build::new();
+    if large_indices {
+        triangle.define("TRITET_LARGE_INDICES", None);
+    }
+    triangle
         .file("c_code/triangle.c")
         .file("c_code/tricall_report.c")
         .file("c_code/interface_triangle.c")
         .define("NO_TIMER", None)
         .compile("c_code_interface_triangle");
-    cc::Build::new()
+    let mut tetgen = cc::Build::new();
+    if large_indices {
+        tetgen.define("TRITET_LARGE_INDICES", None);
+    }
+    tetgen
         .cpp(true)
         .file("c_code/predicates.cxx")
         .file("c_code/tetgen.cxx")
@@ -3,6 +3,18 @@
 
 #include <inttypes.h>
 
+// Index type of the interface layer. The vendored Triangle and TetGen sources
+// hard-code `int` for all connectivity (upstream has no index typedef), so the
+// 64-bit variant additionally requires index-widened copies of those sources;
+// until such sources are vendored, requesting TRITET_LARGE_INDICES is a hard
+// error instead of a silent overflow at about 2^31 corner entries.
+#ifdef TRITET_LARGE_INDICES
+#error "TRITET_LARGE_INDICES requires index-widened Triangle/TetGen sources"
+typedef int64_t tritet_index;
+#else
+typedef int32_t tritet_index;
+#endif
+
 const int32_t TRITET_TRUE = 1;
 const int32_t TRITET_FALSE = 0;
 
@@ -30,4 +42,14 @@ const int32_t TRITET_ERROR_INVALID_HOLE_INDEX = 9000;
 
 const int32_t TRITET_ERROR_TETGEN_FAIL = 10000;
 
+const int32_t TRITET_ERROR_INVALID_BATCH_COUNT = 11000;
+
+const int32_t TRITET_ERROR_NO_TRIANGULATION = 12000;
+const int32_t TRITET_ERROR_POINT_OUTSIDE_HULL = 13000;
+const int32_t TRITET_ERROR_NO_TETRAHEDRA = 14000;
+const int32_t TRITET_ERROR_FILE_IO = 15000;
+const int32_t TRITET_ERROR_INVALID_SNAPSHOT = 16000;
+const int32_t TRITET_ERROR_INVERTED_CELLS = 17000;
+const int32_t TRITET_ERROR_NO_VORONOI = 18000;
+
 #endif  // CONSTANTS_H
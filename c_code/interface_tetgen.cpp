@@ -1,4 +1,5 @@
 #include <inttypes.h>
+#include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
 
@@ -15,6 +16,14 @@ void tet_drop_tetgen(struct ExtTetgen *tetgen) {
     if (tetgen == NULL) {
         return;
     }
+    if (tetgen->facet_arena != NULL) {
+        // the facet structures live in the arena: detach them so that
+        // tetgenio::deinitialize does not walk and delete them one by one
+        tetgen->input.facetlist = NULL;
+        tetgen->input.numberoffacets = 0;
+        delete[] tetgen->facet_arena;
+        tetgen->facet_arena = NULL;
+    }
     delete tetgen;
 }
 
@@ -28,6 +37,7 @@ struct ExtTetgen *tet_new_tetgen(int32_t npoint, int32_t nfacet, int32_t const *
     if (tetgen == NULL) {
         return NULL;
     }
+    tetgen->facet_arena = NULL;
     try {
         tetgen->input.initialize();
         tetgen->output.initialize();
@@ -52,36 +62,44 @@ struct ExtTetgen *tet_new_tetgen(int32_t npoint, int32_t nfacet, int32_t const *
         return NULL;
     }
 
-    // facets
+    // facets: one arena holds the facet array plus every polygon and vertex array
+    // (one polygon per facet), instead of two tiny allocations per facet
     if (nfacet > 0) {
-        tetgen->input.numberoffacets = nfacet;
-        tetgen->input.facetlist = new (std::nothrow) tetgenio::facet[nfacet];
-        if (tetgen->input.facetlist == NULL) {
+        size_t total_nvertex = 0;
+        for (int32_t index = 0; index < nfacet; index++) {
+            total_nvertex += (size_t)facet_npoint[index];
+        }
+        size_t size_facets = (size_t)nfacet * sizeof(tetgenio::facet);
+        size_t size_polygons = (size_t)nfacet * sizeof(tetgenio::polygon);
+        size_t size_vertices = total_nvertex * sizeof(int32_t);
+        tetgen->facet_arena = new (std::nothrow) char[size_facets + size_polygons + size_vertices];
+        if (tetgen->facet_arena == NULL) {
             tet_drop_tetgen(tetgen);
             return NULL;
         }
+        tetgenio::facet *facets = (tetgenio::facet *)tetgen->facet_arena;
+        tetgenio::polygon *polygons = (tetgenio::polygon *)(tetgen->facet_arena + size_facets);
+        int32_t *vertices = (int32_t *)(tetgen->facet_arena + size_facets + size_polygons);
+        tetgen->input.numberoffacets = nfacet;
+        tetgen->input.facetlist = facets;
         tetgen->input.facetmarkerlist = new (std::nothrow) int32_t[nfacet];
-        const int32_t NUM_POLY = 1;
+        if (tetgen->input.facetmarkerlist == NULL) {
+            tet_drop_tetgen(tetgen);
+            return NULL;
+        }
+        size_t offset = 0;
         for (int32_t index = 0; index < nfacet; index++) {
             // facet polygon
-            tetgenio::facet *fac = &tetgen->input.facetlist[index];
-            fac->polygonlist = new (std::nothrow) tetgenio::polygon[NUM_POLY];
-            if (fac->polygonlist == NULL) {
-                tet_drop_tetgen(tetgen);
-                return NULL;
-            }
-            fac->numberofpolygons = NUM_POLY;
+            tetgenio::facet *fac = &facets[index];
+            fac->polygonlist = &polygons[index];
+            fac->numberofpolygons = 1;
             fac->numberofholes = 0;
             fac->holelist = NULL;
             // facet polygon vertices
-            size_t nvertex = facet_npoint[index];
-            tetgenio::polygon *gon = &fac->polygonlist[0];
-            gon->vertexlist = new (std::nothrow) int32_t[nvertex];
-            if (gon->vertexlist == NULL) {
-                tet_drop_tetgen(tetgen);
-                return NULL;
-            }
-            gon->numberofvertices = nvertex;
+            tetgenio::polygon *gon = &polygons[index];
+            gon->vertexlist = &vertices[offset];
+            gon->numberofvertices = facet_npoint[index];
+            offset += (size_t)facet_npoint[index];
             // facet marker
             tetgen->input.facetmarkerlist[index] = 0;
         }
@@ -128,6 +146,58 @@ int32_t tet_set_point(struct ExtTetgen *tetgen, int32_t index, int32_t marker, d
     return TRITET_SUCCESS;
 }
 
+int32_t tet_set_points_batch(struct ExtTetgen *tetgen, int32_t npoint, double const *coords, int32_t const *markers) {
+    if (tetgen == NULL) {
+        return TRITET_ERROR_NULL_DATA;
+    }
+    if (tetgen->input.pointlist == NULL) {
+        return TRITET_ERROR_NULL_POINT_LIST;
+    }
+    if (npoint != tetgen->input.numberofpoints) {
+        return TRITET_ERROR_INVALID_BATCH_COUNT;
+    }
+    memcpy(tetgen->input.pointlist, coords, npoint * 3 * sizeof(double));
+    memcpy(tetgen->input.pointmarkerlist, markers, npoint * sizeof(int32_t));
+    return TRITET_SUCCESS;
+}
+
+int32_t tet_set_facets_batch(struct ExtTetgen *tetgen, int32_t nfacet, int32_t const *offsets, int32_t const *vertices, int32_t const *markers) {
+    if (tetgen == NULL) {
+        return TRITET_ERROR_NULL_DATA;
+    }
+    if (tetgen->input.facetlist == NULL) {
+        return TRITET_ERROR_NULL_FACET_LIST;
+    }
+    if (nfacet != tetgen->input.numberoffacets) {
+        return TRITET_ERROR_INVALID_BATCH_COUNT;
+    }
+    int32_t npoint = tetgen->input.numberofpoints;
+    for (int32_t i = 0; i < offsets[nfacet]; i++) {
+        if (vertices[i] < 0 || vertices[i] >= npoint) {
+            return TRITET_ERROR_INVALID_FACET_POINT_ID;
+        }
+    }
+    for (int32_t index = 0; index < nfacet; index++) {
+        tetgenio::facet *fac = &tetgen->input.facetlist[index];
+        if (fac->polygonlist == NULL) {
+            return TRITET_ERROR_NULL_FACET_POLYGON_LIST;
+        }
+        if (fac->numberofpolygons != 1) {
+            return TRITET_ERROR_INVALID_FACET_NUM_POLYGON;
+        }
+        tetgenio::polygon *gon = &fac->polygonlist[0];
+        int32_t nvertex = offsets[index + 1] - offsets[index];
+        if (nvertex != gon->numberofvertices) {
+            return TRITET_ERROR_INVALID_BATCH_COUNT;
+        }
+        memcpy(gon->vertexlist, &vertices[offsets[index]], nvertex * sizeof(int32_t));
+        if (markers != NULL) {
+            tetgen->input.facetmarkerlist[index] = markers[index];
+        }
+    }
+    return TRITET_SUCCESS;
+}
+
 int32_t tet_set_facet_point(struct ExtTetgen *tetgen, int32_t index, int32_t m, int32_t p) {
     if (tetgen == NULL) {
         return TRITET_ERROR_NULL_DATA;
@@ -211,7 +281,19 @@ int32_t tet_set_hole(struct ExtTetgen *tetgen, int32_t index, double x, double y
     return TRITET_SUCCESS;
 }
 
-int32_t tet_run_delaunay(struct ExtTetgen *tetgen, int32_t verbose) {
+// Releases the arrays of a previous run so that the same context can be rerun.
+// TetGen's output routines allocate fresh arrays unconditionally; thus, the arrays of a
+// previous run would leak if they were not released here.
+static void tet_reset_output(struct ExtTetgen *tetgen) {
+    tetgen->output.deinitialize();
+    tetgen->output.initialize();
+    tetgen->output.marked_faces.clear();
+    tetgen->marked_face_points.clear();
+    tetgen->marked_face_markers.clear();
+    tetgen->marked_face_cells.clear();
+}
+
+int32_t tet_run_delaunay(struct ExtTetgen *tetgen, int32_t verbose, int32_t no_exact) {
     if (tetgen == NULL) {
         return TRITET_ERROR_NULL_DATA;
     }
@@ -219,23 +301,83 @@ int32_t tet_run_delaunay(struct ExtTetgen *tetgen, int32_t verbose) {
         return TRITET_ERROR_NULL_POINT_LIST;
     }
 
+    // Release the output of a previous run (the context is reusable)
+    tet_reset_output(tetgen);
+
     // Tetrahedralize the points
     // Switches:
     // * `z` -- number everything from zero (z)
+    // * `X` -- suppress exact arithmetic (inexact fast path)
     char command[10];
     strcpy(command, "z");
     if (verbose == TRITET_FALSE) {
         strcat(command, "Q");
     }
+    if (no_exact == TRITET_TRUE) {
+        strcat(command, "X");
+    }
     try {
         int status = tetrahedralize(command, &tetgen->input, &tetgen->output, NULL, NULL);
         if (status != 0) {
             return TRITET_ERROR_TETGEN_FAIL;
         }
-    } catch (int32_t status) {
-        printf("status = %d\n", status); // TODO
     } catch (...) {
-        return 1; // TODO
+        // TetGen throws on internal errors (e.g., a failed assertion when
+        // exact arithmetic is suppressed on degenerate input)
+        return TRITET_ERROR_TETGEN_FAIL;
+    }
+
+    return TRITET_SUCCESS;
+}
+
+int32_t tet_run_hull(struct ExtTetgen *tetgen, int32_t verbose, int32_t no_exact) {
+    if (tetgen == NULL) {
+        return TRITET_ERROR_NULL_DATA;
+    }
+    if (tetgen->input.pointlist == NULL) {
+        return TRITET_ERROR_NULL_POINT_LIST;
+    }
+
+    // Release the output of a previous run (the context is reusable)
+    tet_reset_output(tetgen);
+
+    // Tetrahedralize the points, retaining the convex hull
+    // Switches:
+    // * `z` -- number everything from zero (z)
+    // * `c` -- retain the convex hull (tetgenbehavior::convex); no facets are
+    //          recovered and no boundary bookkeeping beyond the hull is done
+    // * `X` -- suppress exact arithmetic (inexact fast path)
+    char command[10];
+    strcpy(command, "zc");
+    if (verbose == TRITET_FALSE) {
+        strcat(command, "Q");
+    }
+    if (no_exact == TRITET_TRUE) {
+        strcat(command, "X");
+    }
+    try {
+        int status = tetrahedralize(command, &tetgen->input, &tetgen->output, NULL, NULL);
+        if (status != 0) {
+            return TRITET_ERROR_TETGEN_FAIL;
+        }
+    } catch (...) {
+        return TRITET_ERROR_TETGEN_FAIL;
+    }
+
+    // Without the 'p'/'r'/'f' switches, TetGen writes exactly the hull triangles into
+    // trifacelist (outhullfaces, with outward-pointing normals); republish them as
+    // marked faces so that the bulk export (tet_out_marked_faces) sees the hull
+    for (int i = 0; i < tetgen->output.numberoftrifaces; i++) {
+        tetgenio::marked_face_t marked_face;
+        marked_face.points[0] = tetgen->output.trifacelist[i * 3];
+        marked_face.points[1] = tetgen->output.trifacelist[i * 3 + 1];
+        marked_face.points[2] = tetgen->output.trifacelist[i * 3 + 2];
+        marked_face.points[3] = 0;
+        marked_face.points[4] = 0;
+        marked_face.points[5] = 0;
+        marked_face.marker = 1; // the default marker for boundary faces
+        marked_face.cell = -1;  // the adjacent tetrahedron is not tracked here
+        tetgen->output.marked_faces.push_back(marked_face);
     }
 
     return TRITET_SUCCESS;
@@ -252,12 +394,16 @@ int32_t tet_run_tetrahedralize(struct ExtTetgen *tetgen, int32_t verbose, int32_
         return TRITET_ERROR_NULL_FACET_LIST;
     }
 
+    // Release the output of a previous run (the context is reusable)
+    tet_reset_output(tetgen);
+
     // Generate mesh
     // Selected:
     // * `p` -- tetrahedralize a piecewise linear complex (PLC)
     // * `z` -- number everything from zero (z)
     // * `A` -- assign a regional attribute to each element (A)
     // * `f` -- Outputs all faces to .face file
+    // * `n` -- Outputs tetrahedra neighbors to .neigh file
     // All:
     // * `b` -- NOT AVAILABLE / DISABLED
     // * `p` -- Tetrahedralize a piecewise linear complex (PLC)
@@ -295,7 +441,7 @@ int32_t tet_run_tetrahedralize(struct ExtTetgen *tetgen, int32_t verbose, int32_
     // * `V` -- Verbose: Detailed information, more terminal output
     // * `h` -- Help: A brief instruction for using TetGen
     char command[128];
-    strcpy(command, "pzAf");
+    strcpy(command, "pzAfn");
     if (verbose == TRITET_FALSE) {
         strcat(command, "Q");
     }
@@ -325,15 +471,486 @@ int32_t tet_run_tetrahedralize(struct ExtTetgen *tetgen, int32_t verbose, int32_
         if (status != 0) {
             return TRITET_ERROR_TETGEN_FAIL;
         }
-    } catch (int32_t status) {
-        printf("status = %d\n", status); // TODO
     } catch (...) {
-        return 1; // TODO
+        // TetGen throws on internal errors (e.g., a failed assertion when
+        // exact arithmetic is suppressed on degenerate input)
+        return TRITET_ERROR_TETGEN_FAIL;
+    }
+
+    return TRITET_SUCCESS;
+}
+
+// Fills a tetgenbehavior directly (the constructor sets TetGen's defaults),
+// skipping parse_commandline; this reaches the levers the switch string
+// cannot express (Steiner cap, optimization level, coplanar tolerance, ...)
+static void tet_fill_behavior(tetgenbehavior *behavior, struct TetOptions const *options) {
+    behavior->plc = 1;          // 'p' -- tetrahedralize a piecewise linear complex (PLC)
+    behavior->zeroindex = 1;    // 'z' -- number everything from zero
+    behavior->regionattrib = 1; // 'A' -- assign a regional attribute to each element
+    behavior->facesout = 1;     // 'f' -- output all faces
+    behavior->neighout = 1;     // 'n' -- output the tetrahedra neighbors
+    behavior->quality = 1;      // 'q' -- refine the mesh (as tet_run_tetrahedralize always does)
+    if (options->verbose == TRITET_FALSE) {
+        behavior->quiet = 1; // 'Q'
+    }
+    if (options->o2 == TRITET_TRUE) {
+        behavior->order = 2; // 'o2'
+    }
+    if (options->max_volume > 0.0) {
+        behavior->fixedvolume = 1; // 'a'
+        behavior->maxvolume = options->max_volume;
+    }
+    if (options->min_dihedral > 0.0) {
+        behavior->mindihedral = options->min_dihedral; // 'q//'
+    }
+    if (options->radius_edge_ratio > 0.0) {
+        behavior->minratio = options->radius_edge_ratio; // 'q'
+    }
+    if (options->coplanar_tol > 0.0) {
+        behavior->epsilon = options->coplanar_tol; // 'T'
+    }
+    if (options->max_steiner >= 0) {
+        behavior->steinerleft = options->max_steiner; // 'S'
+    }
+    if (options->opt_level >= 0) {
+        behavior->optlevel = options->opt_level; // 'O'
+    }
+    if (options->opt_scheme >= 0) {
+        behavior->optscheme = options->opt_scheme; // 'O/'
+    }
+    if (options->no_merge == TRITET_TRUE) {
+        behavior->nomergefacet = 1; // 'M'
+        behavior->nomergevertex = 1;
+    }
+    if (options->no_exact == TRITET_TRUE) {
+        behavior->noexact = 1; // 'X'
+    }
+    if (options->no_bisect == TRITET_TRUE) {
+        behavior->nobisect = 1; // 'Y'
+    }
+}
+
+int32_t tet_run_tetrahedralize_options(struct ExtTetgen *tetgen, struct TetOptions const *options) {
+    if (tetgen == NULL || options == NULL) {
+        return TRITET_ERROR_NULL_DATA;
+    }
+    if (tetgen->input.pointlist == NULL) {
+        return TRITET_ERROR_NULL_POINT_LIST;
+    }
+    if (tetgen->input.facetlist == NULL) {
+        return TRITET_ERROR_NULL_FACET_LIST;
+    }
+
+    // Release the output of a previous run (the context is reusable)
+    tet_reset_output(tetgen);
+
+    tetgenbehavior behavior;
+    tet_fill_behavior(&behavior, options);
+
+    try {
+        int status = tetrahedralize(&behavior, &tetgen->input, &tetgen->output, NULL, NULL);
+        if (status != 0) {
+            return TRITET_ERROR_TETGEN_FAIL;
+        }
+    } catch (...) {
+        // TetGen throws on internal errors (e.g., a failed assertion when
+        // exact arithmetic is suppressed on degenerate input)
+        return TRITET_ERROR_TETGEN_FAIL;
+    }
+
+    return TRITET_SUCCESS;
+}
+
+int32_t tet_run_tetrahedralize_bgm(struct ExtTetgen *tetgen, struct TetOptions const *options, int32_t npoint, double const *point_sizes) {
+    if (tetgen == NULL || options == NULL || point_sizes == NULL) {
+        return TRITET_ERROR_NULL_DATA;
+    }
+    if (tetgen->input.pointlist == NULL) {
+        return TRITET_ERROR_NULL_POINT_LIST;
+    }
+    if (tetgen->input.facetlist == NULL) {
+        return TRITET_ERROR_NULL_FACET_LIST;
+    }
+    if (tetgen->output.pointlist == NULL || tetgen->output.tetrahedronlist == NULL || tetgen->output.numberoftetrahedra < 1) {
+        return TRITET_ERROR_NO_TETRAHEDRA;
+    }
+    if (npoint != tetgen->output.numberofpoints) {
+        return TRITET_ERROR_INVALID_BATCH_COUNT;
+    }
+
+    // Move the previous output into a local tetgenio to serve as the background
+    // mesh: the arrays are stolen (not copied) and freed by the local destructor;
+    // the stolen pointers are cleared so that tet_reset_output does not free them
+    tetgenio bgm;
+    bgm.firstnumber = 0;
+    bgm.numberofpoints = tetgen->output.numberofpoints;
+    bgm.pointlist = tetgen->output.pointlist;
+    bgm.numberoftetrahedra = tetgen->output.numberoftetrahedra;
+    bgm.numberofcorners = tetgen->output.numberofcorners;
+    bgm.tetrahedronlist = tetgen->output.tetrahedronlist;
+    tetgen->output.pointlist = NULL;
+    tetgen->output.tetrahedronlist = NULL;
+
+    // The sizing function: the desired edge length at each background point
+    bgm.numberofpointmtrs = 1;
+    bgm.pointmtrlist = new (std::nothrow) double[npoint];
+    if (bgm.pointmtrlist == NULL) {
+        return TRITET_ERROR_NULL_DATA;
+    }
+    memcpy(bgm.pointmtrlist, point_sizes, npoint * sizeof(double));
+
+    // Release the (now empty) output of the previous run
+    tet_reset_output(tetgen);
+
+    tetgenbehavior behavior;
+    tet_fill_behavior(&behavior, options);
+    behavior.metric = 1; // 'm' -- use the background mesh as sizing function
+
+    try {
+        int status = tetrahedralize(&behavior, &tetgen->input, &tetgen->output, NULL, &bgm);
+        if (status != 0) {
+            return TRITET_ERROR_TETGEN_FAIL;
+        }
+    } catch (...) {
+        // TetGen throws its status codes on internal errors
+        return TRITET_ERROR_TETGEN_FAIL;
     }
 
     return TRITET_SUCCESS;
 }
 
+int32_t tet_run_refine(struct ExtTetgen *tetgen, int32_t verbose, int32_t ncell, double const *per_cell_max_volume, double radius_edge_ratio) {
+    if (tetgen == NULL) {
+        return TRITET_ERROR_NULL_DATA;
+    }
+    if (tetgen->output.pointlist == NULL || tetgen->output.tetrahedronlist == NULL || tetgen->output.numberoftetrahedra < 1) {
+        return TRITET_ERROR_NO_TETRAHEDRA;
+    }
+    if (per_cell_max_volume != NULL && ncell != tetgen->output.numberoftetrahedra) {
+        return TRITET_ERROR_INVALID_BATCH_COUNT;
+    }
+
+    // Move the previous output into a local tetgenio to serve as the mesh to
+    // reconstruct: the arrays are stolen (not copied) and freed by the local
+    // destructor; the stolen pointers are cleared so that tet_reset_output
+    // does not free them again
+    tetgenio mesh;
+    mesh.initialize();
+    mesh.firstnumber = 0;
+    mesh.numberofpoints = tetgen->output.numberofpoints;
+    mesh.pointlist = tetgen->output.pointlist;
+    mesh.pointmarkerlist = tetgen->output.pointmarkerlist;
+    mesh.numberoftetrahedra = tetgen->output.numberoftetrahedra;
+    mesh.numberofcorners = tetgen->output.numberofcorners;
+    mesh.tetrahedronlist = tetgen->output.tetrahedronlist;
+    mesh.numberoftetrahedronattributes = tetgen->output.numberoftetrahedronattributes;
+    mesh.tetrahedronattributelist = tetgen->output.tetrahedronattributelist;
+    tetgen->output.pointlist = NULL;
+    tetgen->output.pointmarkerlist = NULL;
+    tetgen->output.tetrahedronlist = NULL;
+    tetgen->output.tetrahedronattributelist = NULL;
+
+    // Release the (now empty) output of the previous run
+    tet_reset_output(tetgen);
+
+    // Per-element volume constraints (read by reconstructmesh when 'a' is
+    // given without a number, i.e., varvolume)
+    tetgenbehavior behavior;
+    behavior.refine = 1;    // 'r' -- reconstruct a previously generated mesh
+    behavior.zeroindex = 1; // 'z' -- number everything from zero
+    behavior.facesout = 1;  // 'f' -- output all faces
+    behavior.neighout = 1;  // 'n' -- output the tetrahedra neighbors
+    behavior.quality = 1;   // 'q' -- refine the mesh
+    if (verbose == TRITET_FALSE) {
+        behavior.quiet = 1; // 'Q'
+    }
+    if (radius_edge_ratio > 0.0) {
+        behavior.minratio = radius_edge_ratio; // 'q'
+    }
+    if (per_cell_max_volume != NULL) {
+        behavior.varvolume = 1; // 'a' (without a number)
+        mesh.tetrahedronvolumelist = new (std::nothrow) double[ncell];
+        if (mesh.tetrahedronvolumelist == NULL) {
+            return TRITET_ERROR_NULL_DATA;
+        }
+        memcpy(mesh.tetrahedronvolumelist, per_cell_max_volume, ncell * sizeof(double));
+    }
+
+    try {
+        int status = tetrahedralize(&behavior, &mesh, &tetgen->output, NULL, NULL);
+        if (status != 0) {
+            return TRITET_ERROR_TETGEN_FAIL;
+        }
+    } catch (...) {
+        // TetGen throws its status codes on internal errors
+        return TRITET_ERROR_TETGEN_FAIL;
+    }
+
+    return TRITET_SUCCESS;
+}
+
+int32_t tet_adopt_output_as_input(struct ExtTetgen *tetgen) {
+    if (tetgen == NULL) {
+        return TRITET_ERROR_NULL_DATA;
+    }
+    if (tetgen->output.pointlist == NULL || tetgen->output.tetrahedronlist == NULL || tetgen->output.numberoftetrahedra < 1) {
+        return TRITET_ERROR_NO_TETRAHEDRA;
+    }
+
+    // the facet structures live in the arena: detach them so that
+    // tetgenio::deinitialize does not walk and delete them one by one
+    if (tetgen->facet_arena != NULL) {
+        tetgen->input.facetlist = NULL;
+        tetgen->input.numberoffacets = 0;
+        delete[] tetgen->facet_arena;
+        tetgen->facet_arena = NULL;
+    }
+
+    // The previous input is released; the output arrays then move pointer-wise: the
+    // struct assignment transfers every pointer and count, and re-initializing the
+    // output afterwards leaves the input as the sole owner
+    tetgen->input.deinitialize();
+    tetgen->input = tetgen->output;
+    tetgen->input.marked_faces.clear(); // the faces describe the (now consumed) output
+    tetgen->output.initialize();
+    tet_reset_output(tetgen);
+
+    return TRITET_SUCCESS;
+}
+
+int32_t tet_set_output_mesh(struct ExtTetgen *tetgen,
+                            int32_t npoint, double const *coords, int32_t const *point_markers,
+                            int32_t ncell, int32_t const *tetrahedra, int32_t const *attributes) {
+    if (tetgen == NULL || coords == NULL || point_markers == NULL || tetrahedra == NULL || attributes == NULL) {
+        return TRITET_ERROR_NULL_DATA;
+    }
+    if (npoint < 4 || ncell < 1) {
+        return TRITET_ERROR_INVALID_BATCH_COUNT;
+    }
+
+    // Replace the previous output
+    tet_reset_output(tetgen);
+
+    // Points and tetrahedra (the attributes are stored as double, following TetGen)
+    tetgen->output.firstnumber = 0;
+    tetgen->output.pointlist = new (std::nothrow) double[(size_t)npoint * 3];
+    tetgen->output.pointmarkerlist = new (std::nothrow) int[npoint];
+    tetgen->output.tetrahedronlist = new (std::nothrow) int[(size_t)ncell * 4];
+    tetgen->output.tetrahedronattributelist = new (std::nothrow) double[ncell];
+    if (tetgen->output.pointlist == NULL || tetgen->output.pointmarkerlist == NULL ||
+        tetgen->output.tetrahedronlist == NULL || tetgen->output.tetrahedronattributelist == NULL) {
+        tet_reset_output(tetgen);
+        return TRITET_ERROR_NULL_DATA;
+    }
+    memcpy(tetgen->output.pointlist, coords, (size_t)npoint * 3 * sizeof(double));
+    memcpy(tetgen->output.pointmarkerlist, point_markers, (size_t)npoint * sizeof(int32_t));
+    memcpy(tetgen->output.tetrahedronlist, tetrahedra, (size_t)ncell * 4 * sizeof(int32_t));
+    for (int32_t i = 0; i < ncell; i++) {
+        tetgen->output.tetrahedronattributelist[i] = attributes[i];
+    }
+    tetgen->output.numberofpoints = npoint;
+    tetgen->output.numberoftetrahedra = ncell;
+    tetgen->output.numberofcorners = 4;
+    tetgen->output.numberoftetrahedronattributes = 1;
+
+    return TRITET_SUCCESS;
+}
+
+// The snapshot layout: magic, then the counts, then the raw array blocks in order
+// (only the blocks whose count/flag is nonzero are present)
+static const char TET_SNAPSHOT_MAGIC[8] = {'T', 'T', 'S', 'N', 'A', 'P', '0', '2'};
+
+struct TetSnapshotHeader {
+    char magic[8];
+    int64_t npoint;
+    int64_t ncorner;
+    int64_t ntetrahedron;
+    int64_t nattribute;     // attributes per tetrahedron
+    int64_t n_marked_face;
+    int64_t has_point_markers;
+    int64_t has_neighbors;
+    int64_t coords_f32; // coordinates stored as float instead of double
+};
+
+// number of coordinates converted per fwrite/fread when narrowing to float
+#define TET_SNAPSHOT_CHUNK 768
+
+int32_t tet_write_snapshot(struct ExtTetgen *tetgen, char const *filename, int32_t f32_coords) {
+    if (tetgen == NULL || filename == NULL) {
+        return TRITET_ERROR_NULL_DATA;
+    }
+    if (tetgen->output.pointlist == NULL || tetgen->output.tetrahedronlist == NULL || tetgen->output.numberoftetrahedra < 1) {
+        return TRITET_ERROR_NO_TETRAHEDRA;
+    }
+
+    struct TetSnapshotHeader header;
+    memcpy(header.magic, TET_SNAPSHOT_MAGIC, 8);
+    header.npoint = tetgen->output.numberofpoints;
+    header.ncorner = tetgen->output.numberofcorners;
+    header.ntetrahedron = tetgen->output.numberoftetrahedra;
+    header.nattribute = tetgen->output.numberoftetrahedronattributes;
+    header.n_marked_face = tetgen->output.marked_faces.size();
+    header.has_point_markers = tetgen->output.pointmarkerlist != NULL ? 1 : 0;
+    header.has_neighbors = tetgen->output.neighborlist != NULL ? 1 : 0;
+    header.coords_f32 = f32_coords == TRITET_TRUE ? 1 : 0;
+
+    FILE *file = fopen(filename, "wb");
+    if (file == NULL) {
+        return TRITET_ERROR_FILE_IO;
+    }
+    size_t count = 0;
+    count += fwrite(&header, sizeof(header), 1, file) != 1;
+    if (header.coords_f32) {
+        // narrow to float through a fixed buffer (no full-size temporary)
+        float buffer[TET_SNAPSHOT_CHUNK];
+        int64_t total = header.npoint * 3;
+        for (int64_t done = 0; done < total; done += TET_SNAPSHOT_CHUNK) {
+            int64_t n = total - done < TET_SNAPSHOT_CHUNK ? total - done : TET_SNAPSHOT_CHUNK;
+            for (int64_t i = 0; i < n; i++) {
+                buffer[i] = (float)tetgen->output.pointlist[done + i];
+            }
+            count += fwrite(buffer, sizeof(float), n, file) != (size_t)n;
+        }
+    } else {
+        count += fwrite(tetgen->output.pointlist, sizeof(double), header.npoint * 3, file) != (size_t)(header.npoint * 3);
+    }
+    if (header.has_point_markers) {
+        count += fwrite(tetgen->output.pointmarkerlist, sizeof(int32_t), header.npoint, file) != (size_t)header.npoint;
+    }
+    count += fwrite(tetgen->output.tetrahedronlist, sizeof(int32_t), header.ntetrahedron * header.ncorner, file) != (size_t)(header.ntetrahedron * header.ncorner);
+    if (header.nattribute > 0) {
+        count += fwrite(tetgen->output.tetrahedronattributelist, sizeof(double), header.ntetrahedron * header.nattribute, file) != (size_t)(header.ntetrahedron * header.nattribute);
+    }
+    if (header.has_neighbors) {
+        count += fwrite(tetgen->output.neighborlist, sizeof(int32_t), header.ntetrahedron * 4, file) != (size_t)(header.ntetrahedron * 4);
+    }
+    if (header.n_marked_face > 0) {
+        count += fwrite(tetgen->output.marked_faces.data(), sizeof(tetgenio::marked_face_t), header.n_marked_face, file) != (size_t)header.n_marked_face;
+    }
+    if (fclose(file) != 0 || count != 0) {
+        return TRITET_ERROR_FILE_IO;
+    }
+    return TRITET_SUCCESS;
+}
+
+int32_t tet_read_snapshot(struct ExtTetgen *tetgen, char const *filename) {
+    if (tetgen == NULL || filename == NULL) {
+        return TRITET_ERROR_NULL_DATA;
+    }
+
+    FILE *file = fopen(filename, "rb");
+    if (file == NULL) {
+        return TRITET_ERROR_FILE_IO;
+    }
+
+    struct TetSnapshotHeader header;
+    if (fread(&header, sizeof(header), 1, file) != 1 || memcmp(header.magic, TET_SNAPSHOT_MAGIC, 8) != 0 ||
+        header.npoint < 4 || header.ntetrahedron < 1 || (header.ncorner != 4 && header.ncorner != 10) ||
+        header.nattribute < 0 || header.n_marked_face < 0 ||
+        (header.has_point_markers != 0 && header.has_point_markers != 1) ||
+        (header.has_neighbors != 0 && header.has_neighbors != 1) ||
+        (header.coords_f32 != 0 && header.coords_f32 != 1)) {
+        fclose(file);
+        return TRITET_ERROR_INVALID_SNAPSHOT;
+    }
+
+    // All blocks are fixed-size, so the header fully determines the file size; a
+    // corrupted count (e.g., a huge n_marked_face) must be rejected here, before it
+    // reaches the allocations below
+    int64_t file_size;
+    if (fseek(file, 0, SEEK_END) != 0 || (file_size = (int64_t)ftell(file)) < 0 ||
+        fseek(file, (long)sizeof(header), SEEK_SET) != 0) {
+        fclose(file);
+        return TRITET_ERROR_FILE_IO;
+    }
+    int64_t remaining = file_size - (int64_t)sizeof(header);
+    if (header.npoint > remaining || header.ntetrahedron > remaining ||
+        header.nattribute > remaining || header.n_marked_face > remaining) {
+        fclose(file);
+        return TRITET_ERROR_INVALID_SNAPSHOT;
+    }
+    int64_t expected = (int64_t)sizeof(header)
+        + header.npoint * 3 * (int64_t)(header.coords_f32 ? sizeof(float) : sizeof(double))
+        + (header.has_point_markers ? header.npoint * (int64_t)sizeof(int32_t) : 0)
+        + header.ntetrahedron * header.ncorner * (int64_t)sizeof(int32_t)
+        + header.ntetrahedron * header.nattribute * (int64_t)sizeof(double)
+        + (header.has_neighbors ? header.ntetrahedron * 4 * (int64_t)sizeof(int32_t) : 0)
+        + header.n_marked_face * (int64_t)sizeof(tetgenio::marked_face_t);
+    if (expected != file_size) {
+        fclose(file);
+        return TRITET_ERROR_INVALID_SNAPSHOT;
+    }
+
+    // Release the previous output and adopt the snapshot arrays (bulk reads)
+    tet_reset_output(tetgen);
+    tetgen->output.firstnumber = 0;
+    tetgen->output.numberofpoints = header.npoint;
+    tetgen->output.numberofcorners = header.ncorner;
+    tetgen->output.numberoftetrahedra = header.ntetrahedron;
+    tetgen->output.numberoftetrahedronattributes = header.nattribute;
+
+    size_t count = 0;
+    tetgen->output.pointlist = new (std::nothrow) double[header.npoint * 3];
+    if (tetgen->output.pointlist == NULL) {
+        fclose(file);
+        return TRITET_ERROR_NULL_DATA;
+    }
+    if (header.coords_f32) {
+        // widen the narrowed coordinates back to double through a fixed buffer
+        float buffer[TET_SNAPSHOT_CHUNK];
+        int64_t total = header.npoint * 3;
+        for (int64_t done = 0; done < total; done += TET_SNAPSHOT_CHUNK) {
+            int64_t n = total - done < TET_SNAPSHOT_CHUNK ? total - done : TET_SNAPSHOT_CHUNK;
+            count += fread(buffer, sizeof(float), n, file) != (size_t)n;
+            for (int64_t i = 0; i < n; i++) {
+                tetgen->output.pointlist[done + i] = (double)buffer[i];
+            }
+        }
+    } else {
+        count += fread(tetgen->output.pointlist, sizeof(double), header.npoint * 3, file) != (size_t)(header.npoint * 3);
+    }
+    if (header.has_point_markers) {
+        tetgen->output.pointmarkerlist = new (std::nothrow) int[header.npoint];
+        if (tetgen->output.pointmarkerlist == NULL) {
+            fclose(file);
+            return TRITET_ERROR_NULL_DATA;
+        }
+        count += fread(tetgen->output.pointmarkerlist, sizeof(int32_t), header.npoint, file) != (size_t)header.npoint;
+    }
+    tetgen->output.tetrahedronlist = new (std::nothrow) int[header.ntetrahedron * header.ncorner];
+    if (tetgen->output.tetrahedronlist == NULL) {
+        fclose(file);
+        return TRITET_ERROR_NULL_DATA;
+    }
+    count += fread(tetgen->output.tetrahedronlist, sizeof(int32_t), header.ntetrahedron * header.ncorner, file) != (size_t)(header.ntetrahedron * header.ncorner);
+    if (header.nattribute > 0) {
+        tetgen->output.tetrahedronattributelist = new (std::nothrow) double[header.ntetrahedron * header.nattribute];
+        if (tetgen->output.tetrahedronattributelist == NULL) {
+            fclose(file);
+            return TRITET_ERROR_NULL_DATA;
+        }
+        count += fread(tetgen->output.tetrahedronattributelist, sizeof(double), header.ntetrahedron * header.nattribute, file) != (size_t)(header.ntetrahedron * header.nattribute);
+    }
+    if (header.has_neighbors) {
+        tetgen->output.neighborlist = new (std::nothrow) int[header.ntetrahedron * 4];
+        if (tetgen->output.neighborlist == NULL) {
+            fclose(file);
+            return TRITET_ERROR_NULL_DATA;
+        }
+        count += fread(tetgen->output.neighborlist, sizeof(int32_t), header.ntetrahedron * 4, file) != (size_t)(header.ntetrahedron * 4);
+    }
+    if (header.n_marked_face > 0) {
+        tetgen->output.marked_faces.resize(header.n_marked_face);
+        count += fread(tetgen->output.marked_faces.data(), sizeof(tetgenio::marked_face_t), header.n_marked_face, file) != (size_t)header.n_marked_face;
+    }
+    fclose(file);
+    if (count != 0) {
+        tet_reset_output(tetgen);
+        return TRITET_ERROR_INVALID_SNAPSHOT;
+    }
+    return TRITET_SUCCESS;
+}
+
 int32_t tet_out_npoint(struct ExtTetgen *tetgen) {
     if (tetgen == NULL) {
         return 0;
@@ -360,7 +977,7 @@ double tet_out_point(struct ExtTetgen *tetgen, int32_t index, int32_t dim) {
         return 0.0;
     }
     if (index >= 0 && index < tetgen->output.numberofpoints && (dim == 0 || dim == 1 || dim == 2)) {
-        return tetgen->output.pointlist[index * 3 + dim];
+        return tetgen->output.pointlist[(size_t)index * 3 + dim];
     } else {
         return 0.0;
     }
@@ -382,18 +999,36 @@ int32_t tet_out_cell_point(struct ExtTetgen *tetgen, int32_t index, int32_t corn
         return 0;
     }
     if (index >= 0 && index < tetgen->output.numberoftetrahedra && corner < tetgen->output.numberofcorners) {
-        return tetgen->output.tetrahedronlist[index * tetgen->output.numberofcorners + corner];
+        return tetgen->output.tetrahedronlist[(size_t)index * tetgen->output.numberofcorners + corner];
     } else {
         return 0;
     }
 }
 
+int32_t tet_out_cell_neighbor(struct ExtTetgen *tetgen, int32_t index, int32_t side) {
+    if (tetgen == NULL || tetgen->output.neighborlist == NULL) {
+        return -1;
+    }
+    if (index >= 0 && index < tetgen->output.numberoftetrahedra && side >= 0 && side < 4) {
+        return tetgen->output.neighborlist[(size_t)index * 4 + side];
+    } else {
+        return -1;
+    }
+}
+
+const int32_t *tet_out_neighbor_list(struct ExtTetgen *tetgen) {
+    if (tetgen == NULL) {
+        return NULL;
+    }
+    return tetgen->output.neighborlist;
+}
+
 int32_t tet_out_cell_attribute(struct ExtTetgen *tetgen, int32_t index) {
     if (tetgen == NULL) {
         return 0;
     }
     if (index >= 0 && index < tetgen->output.numberoftetrahedra && tetgen->output.numberoftetrahedronattributes > 0) {
-        return tetgen->output.tetrahedronattributelist[index * tetgen->output.numberoftetrahedronattributes];
+        return tetgen->output.tetrahedronattributelist[(size_t)index * tetgen->output.numberoftetrahedronattributes];
     } else {
         return 0;
     }
@@ -424,3 +1059,200 @@ void tet_out_marked_face(struct ExtTetgen *tetgen, int32_t index, int32_t *point
         return;
     }
 }
+
+void tet_out_stats(struct ExtTetgen *tetgen, struct TetStats *stats) {
+    if (tetgen == NULL || stats == NULL) {
+        return;
+    }
+    stats->delaunay_seconds = tetgen->output.stats.delaunay_seconds;
+    stats->surface_mesh_seconds = tetgen->output.stats.surface_mesh_seconds;
+    stats->sizing_seconds = tetgen->output.stats.sizing_seconds;
+    stats->recovery_seconds = tetgen->output.stats.recovery_seconds;
+    stats->refinement_seconds = tetgen->output.stats.refinement_seconds;
+    stats->optimization_seconds = tetgen->output.stats.optimization_seconds;
+    stats->output_seconds = tetgen->output.stats.output_seconds;
+    stats->total_seconds = tetgen->output.stats.total_seconds;
+    stats->points_inserted = tetgen->output.stats.points_inserted;
+    stats->steiner_on_segments = tetgen->output.stats.steiner_on_segments;
+    stats->steiner_on_facets = tetgen->output.stats.steiner_on_facets;
+    stats->steiner_in_volume = tetgen->output.stats.steiner_in_volume;
+    stats->flips = tetgen->output.stats.flips;
+    stats->duplicated_vertices = tetgen->output.stats.duplicated_vertices;
+    stats->unused_vertices = tetgen->output.stats.unused_vertices;
+}
+
+void tet_out_pool_stats(struct ExtTetgen *tetgen, struct TetPoolStats *stats) {
+    if (tetgen == NULL || stats == NULL) {
+        return;
+    }
+    stats->points_items = tetgen->output.pool_stats.points_items;
+    stats->points_max_items = tetgen->output.pool_stats.points_max_items;
+    stats->tetrahedrons_items = tetgen->output.pool_stats.tetrahedrons_items;
+    stats->tetrahedrons_max_items = tetgen->output.pool_stats.tetrahedrons_max_items;
+    stats->subfaces_items = tetgen->output.pool_stats.subfaces_items;
+    stats->subfaces_max_items = tetgen->output.pool_stats.subfaces_max_items;
+    stats->subsegs_items = tetgen->output.pool_stats.subsegs_items;
+    stats->subsegs_max_items = tetgen->output.pool_stats.subsegs_max_items;
+    stats->pool_peak_bytes = tetgen->output.pool_stats.pool_peak_bytes;
+    stats->work_memory_bytes = tetgen->output.pool_stats.work_memory_bytes;
+}
+
+int32_t tet_out_visit_cells(struct ExtTetgen *tetgen, tet_cell_visitor visitor, void *context, int32_t chunk_size) {
+    if (tetgen == NULL || visitor == NULL) {
+        return TRITET_ERROR_NULL_DATA;
+    }
+    if (chunk_size < 1) {
+        return TRITET_ERROR_INVALID_BATCH_COUNT;
+    }
+    if (tetgen->output.pointlist == NULL || tetgen->output.tetrahedronlist == NULL || tetgen->output.numberoftetrahedra < 1) {
+        return TRITET_ERROR_NO_TETRAHEDRA;
+    }
+    int32_t ncell = tetgen->output.numberoftetrahedra;
+    int32_t ncorner = tetgen->output.numberofcorners;
+    for (int32_t start = 0; start < ncell; start += chunk_size) {
+        int32_t count = ncell - start < chunk_size ? ncell - start : chunk_size;
+        int32_t const *cells = &tetgen->output.tetrahedronlist[(size_t)start * (size_t)ncorner];
+        if (visitor(context, start, count, cells, tetgen->output.pointlist) != 0) {
+            break; // the visitor asked to stop early
+        }
+    }
+    return TRITET_SUCCESS;
+}
+
+// Minimum dihedral angle (degrees) of the tetrahedron with corners a, b, c, d. For each
+// of the six edges, the angle between the two adjacent faces follows from the vectors
+// normal to these faces; both normals are built with the edge itself, so the angle
+// between them is the dihedral angle. Returns zero for a degenerate tetrahedron
+static double tet_min_dihedral(double const *pa, double const *pb, double const *pc, double const *pd) {
+    double const *corner[4] = {pa, pb, pc, pd};
+    // each row: the edge (first two) and the opposite vertices completing the two faces
+    static const int32_t edge[6][4] = {
+        {0, 1, 2, 3}, {0, 2, 1, 3}, {0, 3, 1, 2}, {1, 2, 0, 3}, {1, 3, 0, 2}, {2, 3, 0, 1},
+    };
+    double worst = 180.0;
+    for (int32_t k = 0; k < 6; k++) {
+        double const *a = corner[edge[k][0]];
+        double const *b = corner[edge[k][1]];
+        double const *c = corner[edge[k][2]];
+        double const *d = corner[edge[k][3]];
+        double e[3] = {b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+        double u[3] = {c[0] - a[0], c[1] - a[1], c[2] - a[2]};
+        double v[3] = {d[0] - a[0], d[1] - a[1], d[2] - a[2]};
+        double n1[3] = {e[1] * u[2] - e[2] * u[1], e[2] * u[0] - e[0] * u[2], e[0] * u[1] - e[1] * u[0]};
+        double n2[3] = {e[1] * v[2] - e[2] * v[1], e[2] * v[0] - e[0] * v[2], e[0] * v[1] - e[1] * v[0]};
+        double dot = n1[0] * n2[0] + n1[1] * n2[1] + n1[2] * n2[2];
+        double len = sqrt((n1[0] * n1[0] + n1[1] * n1[1] + n1[2] * n1[2]) *
+                          (n2[0] * n2[0] + n2[1] * n2[1] + n2[2] * n2[2]));
+        if (len <= 0.0) {
+            return 0.0; // a face has zero area
+        }
+        double cosang = dot / len;
+        cosang = cosang > 1.0 ? 1.0 : (cosang < -1.0 ? -1.0 : cosang);
+        double angle = acos(cosang) * (180.0 / 3.14159265358979323846);
+        if (angle < worst) {
+            worst = angle;
+        }
+    }
+    return worst;
+}
+
+// the quality of a cell: its minimum dihedral angle from the first four corners
+// (the corner positions also carry the geometry of quadratic tetrahedra)
+static double tet_cell_quality(struct ExtTetgen *tetgen, int32_t index) {
+    double const *pts = tetgen->output.pointlist;
+    int32_t const *tet = &tetgen->output.tetrahedronlist[(size_t)index * (size_t)tetgen->output.numberofcorners];
+    return tet_min_dihedral(&pts[(size_t)tet[0] * 3], &pts[(size_t)tet[1] * 3], &pts[(size_t)tet[2] * 3],
+                            &pts[(size_t)tet[3] * 3]);
+}
+
+int32_t tet_out_quality_histogram(struct ExtTetgen *tetgen, int32_t nbin, int64_t *histogram, double *min_quality, double *max_quality) {
+    if (tetgen == NULL || histogram == NULL || min_quality == NULL || max_quality == NULL) {
+        return TRITET_ERROR_NULL_DATA;
+    }
+    if (nbin < 1) {
+        return TRITET_ERROR_INVALID_BATCH_COUNT;
+    }
+    if (tetgen->output.pointlist == NULL || tetgen->output.tetrahedronlist == NULL || tetgen->output.numberoftetrahedra < 1) {
+        return TRITET_ERROR_NO_TETRAHEDRA;
+    }
+    for (int32_t bin = 0; bin < nbin; bin++) {
+        histogram[bin] = 0;
+    }
+    double qmin = 180.0;
+    double qmax = 0.0;
+    int32_t ncell = tetgen->output.numberoftetrahedra;
+    for (int32_t t = 0; t < ncell; t++) {
+        double quality = tet_cell_quality(tetgen, t);
+        int32_t bin = (int32_t)(quality * (double)nbin / 90.0);
+        bin = bin < 0 ? 0 : (bin >= nbin ? nbin - 1 : bin);
+        histogram[bin] += 1;
+        qmin = quality < qmin ? quality : qmin;
+        qmax = quality > qmax ? quality : qmax;
+    }
+    *min_quality = qmin;
+    *max_quality = qmax;
+    return TRITET_SUCCESS;
+}
+
+int32_t tet_out_worst_cells(struct ExtTetgen *tetgen, int32_t nworst, int32_t *cells, double *qualities, int32_t *count) {
+    if (tetgen == NULL || cells == NULL || qualities == NULL || count == NULL) {
+        return TRITET_ERROR_NULL_DATA;
+    }
+    if (nworst < 1) {
+        return TRITET_ERROR_INVALID_BATCH_COUNT;
+    }
+    if (tetgen->output.pointlist == NULL || tetgen->output.tetrahedronlist == NULL || tetgen->output.numberoftetrahedra < 1) {
+        return TRITET_ERROR_NO_TETRAHEDRA;
+    }
+    int32_t nkeep = 0;
+    int32_t ncell = tetgen->output.numberoftetrahedra;
+    for (int32_t t = 0; t < ncell; t++) {
+        double quality = tet_cell_quality(tetgen, t);
+        if (nkeep == nworst && quality >= qualities[nkeep - 1]) {
+            continue; // not worse than the kept worst-of-the-best
+        }
+        // insertion into the (short) ascending list
+        int32_t i = nkeep < nworst ? nkeep : nworst - 1;
+        while (i > 0 && qualities[i - 1] > quality) {
+            qualities[i] = qualities[i - 1];
+            cells[i] = cells[i - 1];
+            i--;
+        }
+        qualities[i] = quality;
+        cells[i] = t;
+        nkeep = nkeep < nworst ? nkeep + 1 : nkeep;
+    }
+    *count = nkeep;
+    return TRITET_SUCCESS;
+}
+
+void tet_out_marked_faces(struct ExtTetgen *tetgen, int32_t const **points, int32_t const **markers, int32_t const **cells) {
+    if (tetgen == NULL) {
+        *points = NULL;
+        *markers = NULL;
+        *cells = NULL;
+        return;
+    }
+    size_t n = tetgen->output.marked_faces.size();
+    if (tetgen->marked_face_cells.size() != n) {
+        // build the flat view in one sequential pass (cached until the next run)
+        tetgen->marked_face_points.resize(n * 6);
+        tetgen->marked_face_markers.resize(n);
+        tetgen->marked_face_cells.resize(n);
+        int npoint = tetgen->output.numberofcorners == 10 ? 6 : 3;
+        for (size_t i = 0; i < n; i++) {
+            auto const &marked_face = tetgen->output.marked_faces[i];
+            for (int j = 0; j < npoint; j++) {
+                tetgen->marked_face_points[i * 6 + j] = marked_face.points[j];
+            }
+            for (int j = npoint; j < 6; j++) {
+                tetgen->marked_face_points[i * 6 + j] = 0;
+            }
+            tetgen->marked_face_markers[i] = marked_face.marker;
+            tetgen->marked_face_cells[i] = marked_face.cell;
+        }
+    }
+    *points = tetgen->marked_face_points.data();
+    *markers = tetgen->marked_face_markers.data();
+    *cells = tetgen->marked_face_cells.data();
+}
@@ -8,6 +8,16 @@
 struct ExtTetgen {
     struct tetgenio input;
     struct tetgenio output;
+    // flat (SoA) view of output.marked_faces, built lazily by
+    // tet_out_marked_faces and cleared when the output is reset
+    std::vector<int32_t> marked_face_points;  // 6 entries per face
+    std::vector<int32_t> marked_face_markers; // 1 entry per face
+    std::vector<int32_t> marked_face_cells;   // 1 entry per face
+    // single allocation backing input.facetlist and all of its polygon and vertex
+    // arrays (sized from facet_npoint in tet_new_tetgen); the facet structures are
+    // detached from the input before destruction so that tetgenio::deinitialize
+    // does not walk and delete them one by one
+    char *facet_arena;
 };
 
 struct ExtTetgen *tet_new_tetgen(int32_t npoint, int32_t nfacet, int32_t const *facet_npoint, int32_t nregion, int32_t nhole);
@@ -16,6 +26,10 @@ void tet_drop_tetgen(struct ExtTetgen *tetgen);
 
 int32_t tet_set_point(struct ExtTetgen *tetgen, int32_t index, int32_t marker, double x, double y, double z);
 
+int32_t tet_set_points_batch(struct ExtTetgen *tetgen, int32_t npoint, double const *coords, int32_t const *markers);
+
+int32_t tet_set_facets_batch(struct ExtTetgen *tetgen, int32_t nfacet, int32_t const *offsets, int32_t const *vertices, int32_t const *markers);
+
 int32_t tet_set_facet_point(struct ExtTetgen *tetgen, int32_t index, int32_t m, int32_t p);
 
 int32_t tet_set_facet_marker(struct ExtTetgen *tetgen, int32_t index, int32_t marker);
@@ -24,10 +38,66 @@ int32_t tet_set_region(struct ExtTetgen *tetgen, int32_t index, int32_t attribut
 
 int32_t tet_set_hole(struct ExtTetgen *tetgen, int32_t index, double x, double y, double z);
 
-int32_t tet_run_delaunay(struct ExtTetgen *tetgen, int32_t verbose);
+// Set no_exact to suppress the adaptive exact arithmetic predicates ('X'); with degenerate
+// input the run may then fail with TRITET_ERROR_TETGEN_FAIL -- rerun with exact arithmetic
+int32_t tet_run_delaunay(struct ExtTetgen *tetgen, int32_t verbose, int32_t no_exact);
+
+// Tetrahedralizes the points retaining the convex hull ('c', tetgenbehavior::convex):
+// no facets are needed or recovered, so a hull query pays only for the Delaunay
+// construction. The hull triangles (outward-pointing normals) are republished as
+// marked faces, accessible in bulk via tet_out_marked_faces (marker 1, cell -1).
+// See tet_run_delaunay regarding no_exact
+int32_t tet_run_hull(struct ExtTetgen *tetgen, int32_t verbose, int32_t no_exact);
 
 int32_t tet_run_tetrahedralize(struct ExtTetgen *tetgen, int32_t verbose, int32_t o2, double global_max_volume, double global_min_angle);
 
+// Structured options for tet_run_tetrahedralize_options. Values <= 0 (or < 0 for the
+// integer parameters) select TetGen's defaults. The fields map to tetgenbehavior and are
+// applied directly, skipping the command-string parser.
+struct TetOptions {
+    double max_volume;        // 'a': global maximum tetrahedron volume constraint
+    double min_dihedral;      // 'q//': minimum dihedral angle (degrees)
+    double radius_edge_ratio; // 'q': maximum radius-edge ratio
+    double coplanar_tol;      // 'T': tolerance for the coplanar test
+    int32_t verbose;          // prints TetGen's messages (otherwise quiet)
+    int32_t o2;               // 'o2': quadratic tetrahedra (ten nodes)
+    int32_t max_steiner;      // 'S': cap on the number of added Steiner points
+    int32_t opt_level;        // 'O': mesh optimization level
+    int32_t opt_scheme;       // 'O/': mesh optimization scheme (bitmask)
+    int32_t no_merge;         // 'M': no merge of coplanar facets or very close vertices
+    int32_t no_exact;         // 'X': suppress the adaptive exact arithmetic predicates
+    int32_t no_bisect;        // 'Y': keep the boundary facets intact (no Steiner points on them)
+};
+
+int32_t tet_run_tetrahedralize_options(struct ExtTetgen *tetgen, struct TetOptions const *options);
+
+// Reconstructs the previously generated mesh ('r') and refines it, instead of meshing
+// the PLC from scratch. per_cell_max_volume is an optional (may be NULL) array with one
+// maximum volume constraint per output tetrahedron (ncell entries, TetGen's
+// tetrahedronvolumelist); radius_edge_ratio <= 0 selects TetGen's default
+int32_t tet_run_refine(struct ExtTetgen *tetgen, int32_t verbose, int32_t ncell, double const *per_cell_max_volume, double radius_edge_ratio);
+
+// Meshes the PLC with a background-mesh sizing function ('m'): the previously generated
+// mesh becomes the in-memory background mesh and point_sizes gives the desired edge
+// length at each of its points (npoint entries, TetGen's pointmtrlist). The previous
+// output is consumed; the new (graded) mesh replaces it
+int32_t tet_run_tetrahedralize_bgm(struct ExtTetgen *tetgen, struct TetOptions const *options, int32_t npoint, double const *point_sizes);
+
+// Installs an externally assembled mesh into the output data, so that it can be accessed
+// by the tet_out_* functions. Used by the parallel (domain-decomposed) mesher, which
+// stitches the results of several tetrahedralize() runs into one mesh.
+int32_t tet_set_output_mesh(struct ExtTetgen *tetgen,
+                            int32_t npoint, double const *coords, int32_t const *point_markers,
+                            int32_t ncell, int32_t const *tetrahedra, int32_t const *attributes);
+
+// Moves the output arrays of the previous run into the input pointer-wise (zero copies),
+// so that multi-stage pipelines (e.g., mesh, then re-tetrahedralize the refined point
+// set) chain inside the C++ layer instead of round-tripping every array through the
+// tet_out_*/tet_set_* accessors. The previous input (facets, regions, and holes
+// included) is released and the output becomes empty; the adopted input carries points
+// and tetrahedra but no facets, so the next run is typically a Delaunay one
+int32_t tet_adopt_output_as_input(struct ExtTetgen *tetgen);
+
 int32_t tet_out_npoint(struct ExtTetgen *tetgen);
 
 int32_t tet_out_ncell(struct ExtTetgen *tetgen); // a "cell" here is a "tetrahedron"
@@ -42,8 +112,95 @@ int32_t tet_out_cell_point(struct ExtTetgen *tetgen, int32_t index, int32_t corn
 
 int32_t tet_out_cell_attribute(struct ExtTetgen *tetgen, int32_t index);
 
+int32_t tet_out_cell_neighbor(struct ExtTetgen *tetgen, int32_t index, int32_t side); // -1 means no neighbor
+
+const int32_t *tet_out_neighbor_list(struct ExtTetgen *tetgen);
+
 int32_t tet_out_n_marked_face(struct ExtTetgen *tetgen);
 
 void tet_out_marked_face(struct ExtTetgen *tetgen, int32_t index, int32_t *points_len_6, int32_t *marker, int32_t *cell);
 
+// Writes a compact binary snapshot of the output mesh (fixed header plus raw array
+// blocks in the machine's byte order): points, point markers, tetrahedra, attributes,
+// neighbors, and marked faces. Reading it back is a handful of bulk reads instead of
+// text parsing, giving near-instant restarts from pre-built meshes. Set f32_coords to
+// narrow the coordinates to float during the write (half the bytes; the reader widens
+// them back to double)
+int32_t tet_write_snapshot(struct ExtTetgen *tetgen, char const *filename, int32_t f32_coords);
+
+// Reads a snapshot written by tet_write_snapshot, replacing the current output mesh
+int32_t tet_read_snapshot(struct ExtTetgen *tetgen, char const *filename);
+
+// Phase timings (seconds) and counters captured by the last run, so meshing latency
+// can be attributed to Delaunay construction, boundary recovery, or refinement
+// without parsing TetGen's stdout
+struct TetStats {
+    double delaunay_seconds;     // initial Delaunay (mesh reconstruction when refining)
+    double surface_mesh_seconds; // PLC surface meshing
+    double sizing_seconds;       // background mesh reconstruction and size interpolation
+    double recovery_seconds;     // boundary recovery, hole carving, Delaunay recovery
+    double refinement_seconds;   // quality (Delaunay) refinement
+    double optimization_seconds; // mesh optimization passes
+    double output_seconds;       // writing the output arrays
+    double total_seconds;
+    int64_t points_inserted;     // output points minus input points
+    int64_t steiner_on_segments; // Steiner points added on boundary segments
+    int64_t steiner_on_facets;   // Steiner points added on boundary facets
+    int64_t steiner_in_volume;   // Steiner points added in the interior
+    int64_t flips;               // total elementary flips (1-to-4, 2-to-3, 3-to-2, ...)
+    int64_t duplicated_vertices;
+    int64_t unused_vertices;
+};
+
+// Copies the stats of the last run into the given struct (all zeros before any run)
+void tet_out_stats(struct ExtTetgen *tetgen, struct TetStats *stats);
+
+// Memory pool usage captured by the last run (TetGen's memorypool class manages all
+// element storage), so container memory limits can be sized from the peak (high-water)
+// marks instead of trial and error
+struct TetPoolStats {
+    int64_t points_items;              // live items of the point pool at the end of the run
+    int64_t points_max_items;          // high-water mark of the point pool
+    int64_t tetrahedrons_items;        // live items of the tetrahedron pool
+    int64_t tetrahedrons_max_items;    // high-water mark of the tetrahedron pool
+    int64_t subfaces_items;            // live items of the subface pool
+    int64_t subfaces_max_items;        // high-water mark of the subface pool
+    int64_t subsegs_items;             // live items of the subsegment pool
+    int64_t subsegs_max_items;         // high-water mark of the subsegment pool
+    int64_t pool_peak_bytes;           // peak heap use of the four pools (bytes)
+    int64_t work_memory_bytes;         // bytes of auxiliary working arrays
+};
+
+// Copies the pool stats of the last run into the given struct (all zeros before any run)
+void tet_out_pool_stats(struct ExtTetgen *tetgen, struct TetPoolStats *stats);
+
+// Visitor invoked by tet_out_visit_cells for each chunk of cells: start is the index of
+// the first cell of the chunk, count the number of cells, cells points at the chunk's
+// connectivity (tet_out_cell_npoint entries per cell), and points at the whole
+// coordinate array (three doubles per point). A nonzero return stops the walk
+typedef int32_t (*tet_cell_visitor)(void *context, int32_t start, int32_t count, int32_t const *cells, double const *points);
+
+// Walks the output tetrahedra in chunks of (at most) chunk_size cells, invoking the
+// visitor once per chunk. The chunks are views into the output arrays (no copy), so a
+// consumer can convert/compress/write one chunk while the caller prepares the next,
+// keeping the working set inside the cache instead of streaming the whole mesh twice
+int32_t tet_out_visit_cells(struct ExtTetgen *tetgen, tet_cell_visitor visitor, void *context, int32_t chunk_size);
+
+// Histogram of the per-tetrahedron quality (the minimum dihedral angle, in degrees):
+// nbin bins of equal width spanning [0, 90); larger angles land in the last bin, and
+// min_quality/max_quality receive the exact extremes. Computed in one sequential pass
+// over the output arrays, so gating a solver on mesh quality does not require
+// re-scanning the mesh through the per-element accessors
+int32_t tet_out_quality_histogram(struct ExtTetgen *tetgen, int32_t nbin, int64_t *histogram, double *min_quality, double *max_quality);
+
+// Fills cells/qualities (both with nworst entries) with the (at most) nworst cells of
+// smallest quality (minimum dihedral angle, degrees), sorted worst first; count
+// receives the number of entries actually written
+int32_t tet_out_worst_cells(struct ExtTetgen *tetgen, int32_t nworst, int32_t *cells, double *qualities, int32_t *count);
+
+// Returns the whole marked-face set as flat arrays, written in one sequential pass
+// (n = tet_out_n_marked_face; points has 6 entries per face; markers and cells have
+// one entry per face). The pointers remain valid until the next run
+void tet_out_marked_faces(struct ExtTetgen *tetgen, int32_t const **points, int32_t const **markers, int32_t const **cells);
+
 #endif // INTERFACE_TETGEN_H
\ No newline at end of file
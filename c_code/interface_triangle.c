@@ -1,6 +1,7 @@
 #include "interface_triangle.h"
 
 #include <inttypes.h>
+#include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -47,6 +48,15 @@ void zero_triangle_data(struct triangulateio *data) {
     data->edgemarkerlist = NULL;
     data->normlist = NULL;
     data->numberofedges = 0;
+
+    // pool stats
+    data->poolvertices_items = 0;
+    data->poolvertices_maxitems = 0;
+    data->pooltriangles_items = 0;
+    data->pooltriangles_maxitems = 0;
+    data->poolsubsegs_items = 0;
+    data->poolsubsegs_maxitems = 0;
+    data->pool_peak_bytes = 0;
 }
 
 void free_triangle_data(struct triangulateio *data) {
@@ -111,6 +121,121 @@ void free_triangle_data(struct triangulateio *data) {
     zero_triangle_data(data);
 }
 
+// Grows (never shrinks) the output (and, optionally, Voronoi) arrays so that they can hold
+// the worst-case results of a Delaunay/Voronoi run on the input points. Triangle's writers
+// reuse caller-provided arrays when they are not NULL; thus, keeping the grown buffers
+// across runs avoids the malloc/free churn of adaptation loops that re-triangulate
+// thousands of times. The worst-case counts follow from Euler's formula: at most 2n
+// triangles and 3n edges for n input points. Returns 1 on allocation failure.
+static int32_t tri_reserve_output(struct ExtTrigen *trigen, int32_t with_voronoi) {
+    int32_t npoint = trigen->input.numberofpoints;
+    int32_t max_ntriangle = 2 * npoint;
+    int32_t max_nedge = 3 * npoint;
+    // Delaunay/Voronoi runs do not produce segments nor neighbors; discard the data of a
+    // previous mesh run
+    if (trigen->output.segmentlist != NULL) {
+        free(trigen->output.segmentlist);
+        trigen->output.segmentlist = NULL;
+    }
+    if (trigen->output.segmentmarkerlist != NULL) {
+        free(trigen->output.segmentmarkerlist);
+        trigen->output.segmentmarkerlist = NULL;
+    }
+    trigen->output.numberofsegments = 0;
+    if (trigen->output.neighborlist != NULL) {
+        free(trigen->output.neighborlist);
+        trigen->output.neighborlist = NULL;
+    }
+    // the run updates numberofedges without rewriting the edge arrays (no -e switch),
+    // so a stale edgelist from a previous mesh run would disagree with the new count
+    if (trigen->output.edgelist != NULL) {
+        free(trigen->output.edgelist);
+        trigen->output.edgelist = NULL;
+    }
+    if (trigen->output.edgemarkerlist != NULL) {
+        free(trigen->output.edgemarkerlist);
+        trigen->output.edgemarkerlist = NULL;
+    }
+    trigen->output.numberofedges = 0;
+    if (npoint > trigen->out_point_capacity) {
+        if (trigen->output.pointlist != NULL) {
+            free(trigen->output.pointlist);
+        }
+        if (trigen->output.pointmarkerlist != NULL) {
+            free(trigen->output.pointmarkerlist);
+        }
+        trigen->output.pointlist = (double *)malloc(npoint * 2 * sizeof(double));
+        trigen->output.pointmarkerlist = (int32_t *)malloc(npoint * sizeof(int32_t));
+        if (trigen->output.pointlist == NULL || trigen->output.pointmarkerlist == NULL) {
+            trigen->out_point_capacity = 0;
+            return 1;
+        }
+        trigen->out_point_capacity = npoint;
+    }
+    if (max_ntriangle > trigen->out_triangle_capacity) {
+        if (trigen->output.trianglelist != NULL) {
+            free(trigen->output.trianglelist);
+        }
+        trigen->output.trianglelist = (int32_t *)malloc(max_ntriangle * 3 * sizeof(int32_t));
+        if (trigen->output.trianglelist == NULL) {
+            trigen->out_triangle_capacity = 0;
+            return 1;
+        }
+        trigen->out_triangle_capacity = max_ntriangle;
+    }
+    if (with_voronoi) {
+        if (max_ntriangle > trigen->vor_point_capacity) {
+            if (trigen->voronoi.pointlist != NULL) {
+                free(trigen->voronoi.pointlist);
+            }
+            trigen->voronoi.pointlist = (double *)malloc(max_ntriangle * 2 * sizeof(double));
+            if (trigen->voronoi.pointlist == NULL) {
+                trigen->vor_point_capacity = 0;
+                return 1;
+            }
+            trigen->vor_point_capacity = max_ntriangle;
+        }
+        if (max_nedge > trigen->vor_edge_capacity) {
+            if (trigen->voronoi.edgelist != NULL) {
+                free(trigen->voronoi.edgelist);
+            }
+            if (trigen->voronoi.normlist != NULL) {
+                free(trigen->voronoi.normlist);
+            }
+            trigen->voronoi.edgelist = (int32_t *)malloc(max_nedge * 2 * sizeof(int32_t));
+            trigen->voronoi.normlist = (double *)malloc(max_nedge * 2 * sizeof(double));
+            if (trigen->voronoi.edgelist == NULL || trigen->voronoi.normlist == NULL) {
+                trigen->vor_edge_capacity = 0;
+                return 1;
+            }
+            trigen->vor_edge_capacity = max_nedge;
+        }
+    }
+    return 0;
+}
+
+// Releases the output arrays of a previous run. This must be called before runs whose
+// output size cannot be bounded a priori (e.g., quality meshing with Steiner points),
+// because Triangle's writers would reuse the retained buffers without any capacity check.
+static void tri_release_output(struct ExtTrigen *trigen) {
+    free_triangle_data(&trigen->output);
+    trigen->out_point_capacity = 0;
+    trigen->out_triangle_capacity = 0;
+}
+
+// Drops the cached finite/infinite split of the Voronoi edges; called whenever the
+// Voronoi data changes (see tri_out_voronoi_edge_split). Both sets live in one
+// allocation anchored at vor_finite_edges
+static void tri_clear_voronoi_split(struct ExtTrigen *trigen) {
+    if (trigen->vor_finite_edges != NULL) {
+        free(trigen->vor_finite_edges);
+    }
+    trigen->vor_finite_edges = NULL;
+    trigen->vor_infinite_edges = NULL;
+    trigen->vor_n_finite_edge = 0;
+    trigen->vor_n_infinite_edge = 0;
+}
+
 struct ExtTrigen *tri_new_trigen(int32_t npoint, int32_t nsegment, int32_t nregion, int32_t nhole) {
     if (npoint < 3) {
         return NULL;
@@ -124,6 +249,14 @@ struct ExtTrigen *tri_new_trigen(int32_t npoint, int32_t nsegment, int32_t nregi
     zero_triangle_data(&trigen->input);
     zero_triangle_data(&trigen->output);
     zero_triangle_data(&trigen->voronoi);
+    trigen->out_point_capacity = 0;
+    trigen->out_triangle_capacity = 0;
+    trigen->vor_point_capacity = 0;
+    trigen->vor_edge_capacity = 0;
+    trigen->vor_finite_edges = NULL;
+    trigen->vor_infinite_edges = NULL;
+    trigen->vor_n_finite_edge = 0;
+    trigen->vor_n_infinite_edge = 0;
 
     // points
     trigen->input.pointlist = (double *)malloc(npoint * 2 * sizeof(double));
@@ -189,6 +322,7 @@ void tri_drop_trigen(struct ExtTrigen *trigen) {
     free_triangle_data(&trigen->input);
     free_triangle_data(&trigen->output);
     free_triangle_data(&trigen->voronoi);
+    tri_clear_voronoi_split(trigen);
     free(trigen);
 }
 
@@ -208,6 +342,42 @@ int32_t tri_set_point(struct ExtTrigen *trigen, int32_t index, int32_t marker, d
     return TRITET_SUCCESS;
 }
 
+int32_t tri_set_points_batch(struct ExtTrigen *trigen, int32_t npoint, double const *coords, int32_t const *markers) {
+    if (trigen == NULL) {
+        return TRITET_ERROR_NULL_DATA;
+    }
+    if (trigen->input.pointlist == NULL) {
+        return TRITET_ERROR_NULL_POINT_LIST;
+    }
+    if (npoint != trigen->input.numberofpoints) {
+        return TRITET_ERROR_INVALID_BATCH_COUNT;
+    }
+    memcpy(trigen->input.pointlist, coords, npoint * 2 * sizeof(double));
+    memcpy(trigen->input.pointmarkerlist, markers, npoint * sizeof(int32_t));
+    return TRITET_SUCCESS;
+}
+
+int32_t tri_set_segments_batch(struct ExtTrigen *trigen, int32_t nsegment, int32_t const *segments, int32_t const *markers) {
+    if (trigen == NULL) {
+        return TRITET_ERROR_NULL_DATA;
+    }
+    if (trigen->input.segmentlist == NULL || trigen->input.segmentmarkerlist == NULL) {
+        return TRITET_ERROR_NULL_SEGMENT_LIST;
+    }
+    if (nsegment != trigen->input.numberofsegments) {
+        return TRITET_ERROR_INVALID_BATCH_COUNT;
+    }
+    int32_t npoint = trigen->input.numberofpoints;
+    for (int32_t i = 0; i < nsegment * 2; i++) {
+        if (segments[i] < 0 || segments[i] >= npoint) {
+            return TRITET_ERROR_INVALID_SEGMENT_POINT_ID;
+        }
+    }
+    memcpy(trigen->input.segmentlist, segments, nsegment * 2 * sizeof(int32_t));
+    memcpy(trigen->input.segmentmarkerlist, markers, nsegment * sizeof(int32_t));
+    return TRITET_SUCCESS;
+}
+
 int32_t tri_set_segment(struct ExtTrigen *trigen, int32_t index, int32_t marker, int32_t a, int32_t b) {
     if (trigen == NULL) {
         return TRITET_ERROR_NULL_DATA;
@@ -269,6 +439,11 @@ int32_t tri_run_delaunay(struct ExtTrigen *trigen, int32_t verbose) {
         return TRITET_ERROR_NULL_POINT_LIST;
     }
 
+    // Reserve (or recycle) the output arrays
+    if (tri_reserve_output(trigen, TRITET_FALSE) != 0) {
+        return TRITET_ERROR_NULL_DATA;
+    }
+
     // Triangulate the points
     // Switches:
     // * `z` -- number everything from zero (z)
@@ -299,6 +474,12 @@ int32_t tri_run_voronoi(struct ExtTrigen *trigen, int32_t verbose) {
         return TRITET_ERROR_NULL_POINT_LIST;
     }
 
+    // Reserve (or recycle) the output and Voronoi arrays
+    if (tri_reserve_output(trigen, TRITET_TRUE) != 0) {
+        return TRITET_ERROR_NULL_DATA;
+    }
+    tri_clear_voronoi_split(trigen);
+
     // Triangulate the points
     // Switches:
     // * `z` -- number everything from zero (z)
@@ -333,6 +514,10 @@ int32_t tri_run_triangulate(struct ExtTrigen *trigen, int32_t verbose, int32_t q
         return TRITET_ERROR_NULL_SEGMENT_LIST;
     }
 
+    // Release the output of a previous run; the size of a quality mesh cannot be
+    // bounded beforehand, so the retained buffers must not be reused here
+    tri_release_output(trigen);
+
     // Generate mesh
     // Switches:
     // * `p` -- write a PSLG (p)
@@ -341,8 +526,10 @@ int32_t tri_run_triangulate(struct ExtTrigen *trigen, int32_t verbose, int32_t q
     // * `Q` -- quiet mode
     // * `o2` -- generates second-order elements with six nodes each
     // * `Y` -- prohibits the insertion of Steiner points on the mesh boundary
+    // * `n` -- outputs the triangle neighbor list
+    // * `e` -- outputs the edge list with boundary markers
     char command[128];
-    strcpy(command, "pzA");
+    strcpy(command, "pzAne");
     if (verbose == TRITET_FALSE) {
         strcat(command, "Q");
     }
@@ -384,6 +571,900 @@ int32_t tri_run_triangulate(struct ExtTrigen *trigen, int32_t verbose, int32_t q
     return TRITET_SUCCESS;
 }
 
+// Robust adaptive predicates from triangle.c (their filtered front-ends take
+// mesh/behavior pointers, thus the floating-point filters are replicated here)
+double counterclockwiseadapt(double *pa, double *pb, double *pc, double detsum);
+double incircleadapt(double *pa, double *pb, double *pc, double *pd, double permanent);
+double orient3dadapt(double *pa, double *pb, double *pc, double *pd,
+                     double aheight, double bheight, double cheight, double dheight, double permanent);
+
+#define TRI_INS_EPSILON 1.1102230246251565e-16 /* = 2^(-53) */
+static const double tri_ins_ccwerrboundA = (3.0 + 16.0 * TRI_INS_EPSILON) * TRI_INS_EPSILON;
+static const double tri_ins_iccerrboundA = (10.0 + 96.0 * TRI_INS_EPSILON) * TRI_INS_EPSILON;
+static const double tri_ins_o3derrboundA = (7.0 + 56.0 * TRI_INS_EPSILON) * TRI_INS_EPSILON;
+
+// Returns a positive value if the points a, b, and c occur in counterclockwise order
+static double tri_ins_orient2d(double *pa, double *pb, double *pc) {
+    double detleft = (pa[0] - pc[0]) * (pb[1] - pc[1]);
+    double detright = (pa[1] - pc[1]) * (pb[0] - pc[0]);
+    double det = detleft - detright;
+    double detsum;
+    if (detleft > 0.0) {
+        if (detright <= 0.0) {
+            return det;
+        }
+        detsum = detleft + detright;
+    } else if (detleft < 0.0) {
+        if (detright >= 0.0) {
+            return det;
+        }
+        detsum = -detleft - detright;
+    } else {
+        return det;
+    }
+    double errbound = tri_ins_ccwerrboundA * detsum;
+    if ((det >= errbound) || (-det >= errbound)) {
+        return det;
+    }
+    return counterclockwiseadapt(pa, pb, pc, detsum);
+}
+
+// Returns a positive value if the point d lies inside the circle passing through
+// the (counterclockwise) points a, b, and c
+static double tri_ins_incircle(double *pa, double *pb, double *pc, double *pd) {
+    double adx = pa[0] - pd[0];
+    double bdx = pb[0] - pd[0];
+    double cdx = pc[0] - pd[0];
+    double ady = pa[1] - pd[1];
+    double bdy = pb[1] - pd[1];
+    double cdy = pc[1] - pd[1];
+    double bdxcdy = bdx * cdy;
+    double cdxbdy = cdx * bdy;
+    double alift = adx * adx + ady * ady;
+    double cdxady = cdx * ady;
+    double adxcdy = adx * cdy;
+    double blift = bdx * bdx + bdy * bdy;
+    double adxbdy = adx * bdy;
+    double bdxady = bdx * ady;
+    double clift = cdx * cdx + cdy * cdy;
+    double det = alift * (bdxcdy - cdxbdy) + blift * (cdxady - adxcdy) + clift * (adxbdy - bdxady);
+    double permanent = (fabs(bdxcdy) + fabs(cdxbdy)) * alift +
+                       (fabs(cdxady) + fabs(adxcdy)) * blift +
+                       (fabs(adxbdy) + fabs(bdxady)) * clift;
+    double errbound = tri_ins_iccerrboundA * permanent;
+    if ((det > errbound) || (-det > errbound)) {
+        return det;
+    }
+    return incircleadapt(pa, pb, pc, pd, permanent);
+}
+
+// Returns a positive value if the point d lies below the plane passing through a, b, and c
+// ("below" such that a, b, and c appear counterclockwise when viewed from above); the
+// points are packed (x, y, height) triples as in triangle.c's lifted-map orient3d
+static double tri_ins_orient3d(double *pa, double *pb, double *pc, double *pd) {
+    double adx = pa[0] - pd[0];
+    double bdx = pb[0] - pd[0];
+    double cdx = pc[0] - pd[0];
+    double ady = pa[1] - pd[1];
+    double bdy = pb[1] - pd[1];
+    double cdy = pc[1] - pd[1];
+    double adheight = pa[2] - pd[2];
+    double bdheight = pb[2] - pd[2];
+    double cdheight = pc[2] - pd[2];
+    double bdxcdy = bdx * cdy;
+    double cdxbdy = cdx * bdy;
+    double cdxady = cdx * ady;
+    double adxcdy = adx * cdy;
+    double adxbdy = adx * bdy;
+    double bdxady = bdx * ady;
+    double det = adheight * (bdxcdy - cdxbdy) + bdheight * (cdxady - adxcdy) + cdheight * (adxbdy - bdxady);
+    double permanent = (fabs(bdxcdy) + fabs(cdxbdy)) * fabs(adheight) +
+                       (fabs(cdxady) + fabs(adxcdy)) * fabs(bdheight) +
+                       (fabs(adxbdy) + fabs(bdxady)) * fabs(cdheight);
+    double errbound = tri_ins_o3derrboundA * permanent;
+    if ((det > errbound) || (-det > errbound)) {
+        return det;
+    }
+    return orient3dadapt(pa, pb, pc, pd, pa[2], pb[2], pc[2], pd[2], permanent);
+}
+
+// Block size of the batched predicate kernels below. The filter pass is a flat,
+// branch-free loop over one block, which the compiler can vectorize with whatever
+// SIMD lanes the target offers (AVX2, NEON, ...); only the lanes whose error bound
+// fails take the exact (branchy, scalar) path afterwards
+#define TRI_BATCH_BLOCK 64
+
+void tri_orient2d_batch(int32_t n, double const *pa, double const *pb, double const *pc, double *result) {
+    int8_t needexact[TRI_BATCH_BLOCK];
+    for (int32_t base = 0; base < n; base += TRI_BATCH_BLOCK) {
+        int32_t count = n - base < TRI_BATCH_BLOCK ? n - base : TRI_BATCH_BLOCK;
+        for (int32_t k = 0; k < count; k++) {
+            int32_t i = base + k;
+            double detleft = (pa[i * 2] - pc[i * 2]) * (pb[i * 2 + 1] - pc[i * 2 + 1]);
+            double detright = (pa[i * 2 + 1] - pc[i * 2 + 1]) * (pb[i * 2] - pc[i * 2]);
+            double det = detleft - detright;
+            // |detleft| + |detright| equals the detsum of the scalar filter whenever the
+            // sign of det is actually in doubt, so the same error bound applies
+            double errbound = tri_ins_ccwerrboundA * (fabs(detleft) + fabs(detright));
+            result[i] = det;
+            needexact[k] = (det < errbound) && (-det < errbound);
+        }
+        for (int32_t k = 0; k < count; k++) {
+            if (needexact[k]) {
+                int32_t i = base + k;
+                result[i] = tri_ins_orient2d((double *)&pa[i * 2], (double *)&pb[i * 2], (double *)&pc[i * 2]);
+            }
+        }
+    }
+}
+
+void tri_incircle_batch(int32_t n, double const *pa, double const *pb, double const *pc, double const *pd,
+                        double *result) {
+    int8_t needexact[TRI_BATCH_BLOCK];
+    for (int32_t base = 0; base < n; base += TRI_BATCH_BLOCK) {
+        int32_t count = n - base < TRI_BATCH_BLOCK ? n - base : TRI_BATCH_BLOCK;
+        for (int32_t k = 0; k < count; k++) {
+            int32_t i = base + k;
+            double adx = pa[i * 2] - pd[i * 2];
+            double bdx = pb[i * 2] - pd[i * 2];
+            double cdx = pc[i * 2] - pd[i * 2];
+            double ady = pa[i * 2 + 1] - pd[i * 2 + 1];
+            double bdy = pb[i * 2 + 1] - pd[i * 2 + 1];
+            double cdy = pc[i * 2 + 1] - pd[i * 2 + 1];
+            double bdxcdy = bdx * cdy;
+            double cdxbdy = cdx * bdy;
+            double alift = adx * adx + ady * ady;
+            double cdxady = cdx * ady;
+            double adxcdy = adx * cdy;
+            double blift = bdx * bdx + bdy * bdy;
+            double adxbdy = adx * bdy;
+            double bdxady = bdx * ady;
+            double clift = cdx * cdx + cdy * cdy;
+            double det = alift * (bdxcdy - cdxbdy) + blift * (cdxady - adxcdy) + clift * (adxbdy - bdxady);
+            double permanent = (fabs(bdxcdy) + fabs(cdxbdy)) * alift +
+                               (fabs(cdxady) + fabs(adxcdy)) * blift +
+                               (fabs(adxbdy) + fabs(bdxady)) * clift;
+            double errbound = tri_ins_iccerrboundA * permanent;
+            result[i] = det;
+            needexact[k] = (det <= errbound) && (-det <= errbound);
+        }
+        for (int32_t k = 0; k < count; k++) {
+            if (needexact[k]) {
+                int32_t i = base + k;
+                result[i] = tri_ins_incircle((double *)&pa[i * 2], (double *)&pb[i * 2], (double *)&pc[i * 2],
+                                             (double *)&pd[i * 2]);
+            }
+        }
+    }
+}
+
+void tri_orient3d_batch(int32_t n, double const *pa, double const *pb, double const *pc, double const *pd,
+                        double *result) {
+    int8_t needexact[TRI_BATCH_BLOCK];
+    for (int32_t base = 0; base < n; base += TRI_BATCH_BLOCK) {
+        int32_t count = n - base < TRI_BATCH_BLOCK ? n - base : TRI_BATCH_BLOCK;
+        for (int32_t k = 0; k < count; k++) {
+            int32_t i = base + k;
+            double adx = pa[i * 3] - pd[i * 3];
+            double bdx = pb[i * 3] - pd[i * 3];
+            double cdx = pc[i * 3] - pd[i * 3];
+            double ady = pa[i * 3 + 1] - pd[i * 3 + 1];
+            double bdy = pb[i * 3 + 1] - pd[i * 3 + 1];
+            double cdy = pc[i * 3 + 1] - pd[i * 3 + 1];
+            double adheight = pa[i * 3 + 2] - pd[i * 3 + 2];
+            double bdheight = pb[i * 3 + 2] - pd[i * 3 + 2];
+            double cdheight = pc[i * 3 + 2] - pd[i * 3 + 2];
+            double bdxcdy = bdx * cdy;
+            double cdxbdy = cdx * bdy;
+            double cdxady = cdx * ady;
+            double adxcdy = adx * cdy;
+            double adxbdy = adx * bdy;
+            double bdxady = bdx * ady;
+            double det = adheight * (bdxcdy - cdxbdy) + bdheight * (cdxady - adxcdy) + cdheight * (adxbdy - bdxady);
+            double permanent = (fabs(bdxcdy) + fabs(cdxbdy)) * fabs(adheight) +
+                               (fabs(cdxady) + fabs(adxcdy)) * fabs(bdheight) +
+                               (fabs(adxbdy) + fabs(bdxady)) * fabs(cdheight);
+            double errbound = tri_ins_o3derrboundA * permanent;
+            result[i] = det;
+            needexact[k] = (det <= errbound) && (-det <= errbound);
+        }
+        for (int32_t k = 0; k < count; k++) {
+            if (needexact[k]) {
+                int32_t i = base + k;
+                result[i] = tri_ins_orient3d((double *)&pa[i * 3], (double *)&pb[i * 3], (double *)&pc[i * 3],
+                                             (double *)&pd[i * 3]);
+            }
+        }
+    }
+}
+
+// Builds the triangle adjacency via an open-addressing edge table: adj[t*3+e] becomes
+// the neighbor across the edge from corner e to corner (e+1)%3 (or -1 on the hull).
+// `keys` and `vals` must have table_size entries and table_size must be a power of two
+// greater than 3*ntri
+static void tri_build_adjacency(int32_t const *tri, int32_t ntri, int32_t *adj,
+                                int64_t *keys, int32_t *vals, int32_t table_size) {
+    for (int32_t i = 0; i < table_size; i++) {
+        keys[i] = -1;
+    }
+    for (int32_t t = 0; t < ntri; t++) {
+        for (int32_t e = 0; e < 3; e++) {
+            int32_t a = tri[t * 3 + e];
+            int32_t b = tri[t * 3 + (e + 1) % 3];
+            int64_t key = a < b ? (((int64_t)a << 32) | (uint32_t)b) : (((int64_t)b << 32) | (uint32_t)a);
+            uint64_t h = ((uint64_t)key ^ ((uint64_t)key >> 29)) * 0x9E3779B97F4A7C15ull;
+            int32_t slot = (int32_t)(h & (uint64_t)(table_size - 1));
+            while (keys[slot] != -1 && keys[slot] != key) {
+                slot = (slot + 1) & (table_size - 1);
+            }
+            if (keys[slot] == -1) {
+                keys[slot] = key;
+                vals[slot] = t * 3 + e;
+                adj[t * 3 + e] = -1;
+            } else {
+                int32_t other = vals[slot];
+                adj[t * 3 + e] = other / 3;
+                adj[other] = t;
+            }
+        }
+    }
+}
+
+int32_t tri_insert_points(struct ExtTrigen *trigen, int32_t n, double const *coords) {
+    if (trigen == NULL || coords == NULL) {
+        return TRITET_ERROR_NULL_DATA;
+    }
+    if (n < 1) {
+        return TRITET_ERROR_INVALID_BATCH_COUNT;
+    }
+    struct triangulateio *out = &trigen->output;
+    if (out->pointlist == NULL || out->trianglelist == NULL ||
+        out->numberoftriangles < 1 || out->numberofcorners != 3) {
+        return TRITET_ERROR_NO_TRIANGULATION;
+    }
+
+    // Sizes: each interior insertion adds exactly two triangles
+    int32_t npoint = out->numberofpoints;
+    int32_t ntri = out->numberoftriangles;
+    int32_t npoint_max = npoint + n;
+    int32_t ntri_max = ntri + 2 * n;
+    int32_t table_size = 1;
+    while (table_size < 6 * ntri) {
+        table_size <<= 1;
+    }
+
+    // Single arena holding all the working arrays (doubles first, for alignment)
+    size_t size_pts = (size_t)npoint_max * 2 * sizeof(double);
+    size_t size_keys = (size_t)table_size * sizeof(int64_t);
+    size_t size_i32 = ((size_t)npoint_max * 2       /* pmk, vmap                  */
+                       + (size_t)ntri_max * 3 * 2   /* tri, adj                   */
+                       + (size_t)ntri_max * 3       /* flag, stack, cav           */
+                       + (size_t)(ntri_max + 2) * 4 /* bry (3 each), newtris      */
+                       + (size_t)table_size)        /* vals                       */
+                      * sizeof(int32_t);
+    char *arena = (char *)malloc(size_pts + size_keys + size_i32);
+    if (arena == NULL) {
+        return TRITET_ERROR_NULL_DATA;
+    }
+    double *pts = (double *)arena;
+    int64_t *keys = (int64_t *)(arena + size_pts);
+    int32_t *cursor = (int32_t *)(arena + size_pts + size_keys);
+    int32_t *pmk = cursor; cursor += npoint_max;
+    int32_t *vmap = cursor; cursor += npoint_max;
+    int32_t *tri = cursor; cursor += ntri_max * 3;
+    int32_t *adj = cursor; cursor += ntri_max * 3;
+    int32_t *flag = cursor; cursor += ntri_max;
+    int32_t *stack = cursor; cursor += ntri_max;
+    int32_t *cav = cursor; cursor += ntri_max;
+    int32_t *bry = cursor; cursor += (ntri_max + 2) * 3;
+    int32_t *newtris = cursor; cursor += ntri_max + 2;
+    int32_t *vals = cursor;
+
+    // Warm start from the existing triangulation
+    memcpy(pts, out->pointlist, (size_t)npoint * 2 * sizeof(double));
+    if (out->pointmarkerlist != NULL) {
+        memcpy(pmk, out->pointmarkerlist, (size_t)npoint * sizeof(int32_t));
+    } else {
+        memset(pmk, 0, (size_t)npoint * sizeof(int32_t));
+    }
+    memcpy(tri, out->trianglelist, (size_t)ntri * 3 * sizeof(int32_t));
+    memset(flag, 0, (size_t)ntri_max * sizeof(int32_t));
+
+    // Build the triangle adjacency
+    tri_build_adjacency(tri, ntri, adj, keys, vals, table_size);
+
+    // Insert the points one by one (Bowyer-Watson)
+    int32_t start = 0; // walk from the last created triangle
+    for (int32_t i = 0; i < n; i++) {
+        int32_t ip = npoint + i;
+        pts[ip * 2] = coords[i * 2];
+        pts[ip * 2 + 1] = coords[i * 2 + 1];
+        pmk[ip] = 0;
+        double *pp = &pts[ip * 2];
+
+        // Locate the triangle containing the point by walking across edges
+        int32_t t = start;
+        int32_t found = TRITET_FALSE;
+        for (int32_t guard = 0; guard < 4 * ntri + 4; guard++) {
+            int32_t moved = TRITET_FALSE;
+            for (int32_t e = 0; e < 3; e++) {
+                double *pa = &pts[tri[t * 3 + e] * 2];
+                double *pb = &pts[tri[t * 3 + (e + 1) % 3] * 2];
+                if (tri_ins_orient2d(pa, pb, pp) < 0.0) {
+                    int32_t nb = adj[t * 3 + e];
+                    if (nb < 0) {
+                        free(arena);
+                        return TRITET_ERROR_POINT_OUTSIDE_HULL;
+                    }
+                    t = nb;
+                    moved = TRITET_TRUE;
+                    break;
+                }
+            }
+            if (moved == TRITET_FALSE) {
+                found = TRITET_TRUE;
+                break;
+            }
+        }
+        if (found == TRITET_FALSE) {
+            free(arena);
+            return TRITET_ERROR_POINT_OUTSIDE_HULL;
+        }
+
+        // Find the cavity: all triangles whose (closed) circumdisk contains the point.
+        // Including the cocircular triangles keeps grid-aligned insertions degeneracy-free.
+        // flag: 0 = unknown, 1 = in cavity, 2 = keep (records are reset afterwards;
+        // the keep-list is stored at the tail of `cav` to avoid a fourth array)
+        int32_t ncav = 0;
+        int32_t nkeep = 0;
+        int32_t nbry = 0;
+        int32_t stack_top = 0;
+        flag[t] = 1;
+        cav[ncav++] = t;
+        stack[stack_top++] = t;
+        while (stack_top > 0) {
+            int32_t c = stack[--stack_top];
+            for (int32_t e = 0; e < 3; e++) {
+                int32_t a = tri[c * 3 + e];
+                int32_t b = tri[c * 3 + (e + 1) % 3];
+                int32_t nb = adj[c * 3 + e];
+                int32_t on_boundary = TRITET_FALSE;
+                if (nb < 0 || flag[nb] == 2) {
+                    on_boundary = TRITET_TRUE;
+                } else if (flag[nb] == 0) {
+                    double *qa = &pts[tri[nb * 3] * 2];
+                    double *qb = &pts[tri[nb * 3 + 1] * 2];
+                    double *qc = &pts[tri[nb * 3 + 2] * 2];
+                    if (tri_ins_incircle(qa, qb, qc, pp) >= 0.0) {
+                        flag[nb] = 1;
+                        cav[ncav++] = nb;
+                        stack[stack_top++] = nb;
+                    } else {
+                        flag[nb] = 2;
+                        cav[ntri_max - 1 - nkeep] = nb;
+                        nkeep++;
+                        on_boundary = TRITET_TRUE;
+                    }
+                }
+                if (on_boundary == TRITET_TRUE) {
+                    bry[nbry * 3] = a;
+                    bry[nbry * 3 + 1] = b;
+                    bry[nbry * 3 + 2] = nb;
+                    nbry++;
+                }
+            }
+        }
+
+        // Check the orientation of the boundary edges with the batched kernel: unlike the
+        // cavity expansion above (where each incircle result decides the next test), these
+        // tests are all independent, so the whole fan goes through the vectorized filter
+        int32_t failed = TRITET_FALSE;
+        {
+            double ba[TRI_BATCH_BLOCK * 2], bb[TRI_BATCH_BLOCK * 2], bq[TRI_BATCH_BLOCK * 2], det[TRI_BATCH_BLOCK];
+            for (int32_t base = 0; base < nbry && failed == TRITET_FALSE; base += TRI_BATCH_BLOCK) {
+                int32_t count = nbry - base < TRI_BATCH_BLOCK ? nbry - base : TRI_BATCH_BLOCK;
+                for (int32_t k = 0; k < count; k++) {
+                    int32_t a = bry[(base + k) * 3];
+                    int32_t b = bry[(base + k) * 3 + 1];
+                    ba[k * 2] = pts[a * 2];
+                    ba[k * 2 + 1] = pts[a * 2 + 1];
+                    bb[k * 2] = pts[b * 2];
+                    bb[k * 2 + 1] = pts[b * 2 + 1];
+                    bq[k * 2] = pp[0];
+                    bq[k * 2 + 1] = pp[1];
+                }
+                tri_orient2d_batch(count, ba, bb, bq, det);
+                for (int32_t k = 0; k < count; k++) {
+                    if (det[k] <= 0.0) {
+                        failed = TRITET_TRUE; // duplicate point or degenerate cavity
+                        break;
+                    }
+                }
+            }
+        }
+
+        // Retriangulate the cavity: one new triangle per boundary edge
+        // (the cavity slots are recycled; nbry == ncav + 2 by Euler's formula)
+        for (int32_t j = 0; j < nbry && failed == TRITET_FALSE; j++) {
+            int32_t a = bry[j * 3];
+            int32_t b = bry[j * 3 + 1];
+            int32_t nt = j < ncav ? cav[j] : ntri++;
+            newtris[j] = nt;
+            tri[nt * 3] = a;
+            tri[nt * 3 + 1] = b;
+            tri[nt * 3 + 2] = ip;
+            int32_t outer = bry[j * 3 + 2];
+            adj[nt * 3] = outer;
+            if (outer >= 0) {
+                for (int32_t e = 0; e < 3; e++) {
+                    if (tri[outer * 3 + e] == b && tri[outer * 3 + (e + 1) % 3] == a) {
+                        adj[outer * 3 + e] = nt;
+                        break;
+                    }
+                }
+            }
+            vmap[a] = nt; // the new triangle whose boundary edge starts at `a`
+        }
+        // reset the flags of the touched triangles (cavity and keep-list)
+        for (int32_t j = 0; j < ncav; j++) {
+            flag[cav[j]] = 0;
+        }
+        for (int32_t j = 0; j < nkeep; j++) {
+            flag[cav[ntri_max - 1 - j]] = 0;
+        }
+        if (failed == TRITET_TRUE) {
+            free(arena);
+            return TRITET_ERROR_POINT_OUTSIDE_HULL;
+        }
+        // link the new triangles around the inserted point
+        for (int32_t j = 0; j < nbry; j++) {
+            int32_t nt = newtris[j];
+            int32_t b = tri[nt * 3 + 1];
+            adj[nt * 3 + 1] = vmap[b];
+            adj[vmap[b] * 3 + 2] = nt;
+        }
+        start = newtris[0];
+    }
+
+    // Install the grown triangulation into the output data
+    int32_t npoint_new = npoint + n;
+    double *pointlist = (double *)malloc((size_t)npoint_new * 2 * sizeof(double));
+    int32_t *pointmarkerlist = (int32_t *)malloc((size_t)npoint_new * sizeof(int32_t));
+    int32_t *trianglelist = (int32_t *)malloc((size_t)ntri * 3 * sizeof(int32_t));
+    if (pointlist == NULL || pointmarkerlist == NULL || trianglelist == NULL) {
+        if (pointlist != NULL) {
+            free(pointlist);
+        }
+        if (pointmarkerlist != NULL) {
+            free(pointmarkerlist);
+        }
+        if (trianglelist != NULL) {
+            free(trianglelist);
+        }
+        free(arena);
+        return TRITET_ERROR_NULL_DATA;
+    }
+    memcpy(pointlist, pts, (size_t)npoint_new * 2 * sizeof(double));
+    memcpy(pointmarkerlist, pmk, (size_t)npoint_new * sizeof(int32_t));
+    memcpy(trianglelist, tri, (size_t)ntri * 3 * sizeof(int32_t));
+    free(arena);
+    tri_release_output(trigen);
+    out->pointlist = pointlist;
+    out->pointmarkerlist = pointmarkerlist;
+    out->trianglelist = trianglelist;
+    out->numberofpoints = npoint_new;
+    out->numberoftriangles = ntri;
+    out->numberofcorners = 3;
+    return TRITET_SUCCESS;
+}
+
+int32_t tri_move_points(struct ExtTrigen *trigen, int32_t n, double const *coords) {
+    if (trigen == NULL || coords == NULL) {
+        return TRITET_ERROR_NULL_DATA;
+    }
+    struct triangulateio *out = &trigen->output;
+    if (out->pointlist == NULL || out->trianglelist == NULL ||
+        out->numberoftriangles < 1 || out->numberofcorners != 3) {
+        return TRITET_ERROR_NO_TRIANGULATION;
+    }
+    if (n != out->numberofpoints) {
+        return TRITET_ERROR_INVALID_BATCH_COUNT;
+    }
+    int32_t ntri = out->numberoftriangles;
+    int32_t nseg = out->segmentlist != NULL ? out->numberofsegments : 0;
+    int32_t table_size = 1;
+    while (table_size < 6 * ntri) {
+        table_size <<= 1;
+    }
+    int32_t seg_size = 1;
+    while (seg_size < 2 * nseg + 2) {
+        seg_size <<= 1;
+    }
+
+    // Single arena holding all the working arrays (int64 first, for alignment)
+    size_t size_keys = ((size_t)table_size + (size_t)seg_size) * sizeof(int64_t);
+    size_t size_i32 = ((size_t)ntri * 3 * 4  /* tri, adj, stack, instack */
+                       + (size_t)table_size) /* vals                     */
+                      * sizeof(int32_t);
+    char *arena = (char *)malloc(size_keys + size_i32);
+    if (arena == NULL) {
+        return TRITET_ERROR_NULL_DATA;
+    }
+    int64_t *keys = (int64_t *)arena;
+    int64_t *skeys = keys + table_size;
+    int32_t *cursor = (int32_t *)(arena + size_keys);
+    int32_t *tri = cursor; cursor += ntri * 3;
+    int32_t *adj = cursor; cursor += ntri * 3;
+    int32_t *stack = cursor; cursor += ntri * 3;
+    int32_t *instack = cursor; cursor += ntri * 3;
+    int32_t *vals = cursor;
+    double const *pts = coords;
+
+    memcpy(tri, out->trianglelist, (size_t)ntri * 3 * sizeof(int32_t));
+    tri_build_adjacency(tri, ntri, adj, keys, vals, table_size);
+
+    // Key set of the constrained (segment) edges, which must never be flipped
+    for (int32_t i = 0; i < seg_size; i++) {
+        skeys[i] = -1;
+    }
+    for (int32_t i = 0; i < nseg; i++) {
+        int32_t a = out->segmentlist[i * 2];
+        int32_t b = out->segmentlist[i * 2 + 1];
+        int64_t key = a < b ? (((int64_t)a << 32) | (uint32_t)b) : (((int64_t)b << 32) | (uint32_t)a);
+        uint64_t h = ((uint64_t)key ^ ((uint64_t)key >> 29)) * 0x9E3779B97F4A7C15ull;
+        int32_t slot = (int32_t)(h & (uint64_t)(seg_size - 1));
+        while (skeys[slot] != -1 && skeys[slot] != key) {
+            slot = (slot + 1) & (seg_size - 1);
+        }
+        skeys[slot] = key;
+    }
+
+    // Check that no triangle collapses or inverts at the new positions, with the
+    // batched orientation kernel (local flips cannot repair an inverted mesh, so
+    // such a step needs a full retriangulation instead)
+    {
+        double ba[TRI_BATCH_BLOCK * 2], bb[TRI_BATCH_BLOCK * 2], bc[TRI_BATCH_BLOCK * 2], det[TRI_BATCH_BLOCK];
+        for (int32_t base = 0; base < ntri; base += TRI_BATCH_BLOCK) {
+            int32_t count = ntri - base < TRI_BATCH_BLOCK ? ntri - base : TRI_BATCH_BLOCK;
+            for (int32_t k = 0; k < count; k++) {
+                int32_t a = tri[(base + k) * 3];
+                int32_t b = tri[(base + k) * 3 + 1];
+                int32_t c = tri[(base + k) * 3 + 2];
+                ba[k * 2] = pts[a * 2];
+                ba[k * 2 + 1] = pts[a * 2 + 1];
+                bb[k * 2] = pts[b * 2];
+                bb[k * 2 + 1] = pts[b * 2 + 1];
+                bc[k * 2] = pts[c * 2];
+                bc[k * 2 + 1] = pts[c * 2 + 1];
+            }
+            tri_orient2d_batch(count, ba, bb, bc, det);
+            for (int32_t k = 0; k < count; k++) {
+                if (det[k] <= 0.0) {
+                    free(arena);
+                    return TRITET_ERROR_INVERTED_CELLS;
+                }
+            }
+        }
+    }
+
+    // Restore Delaunayhood with Lawson flips: every interior edge is suspect at
+    // first; each flip re-queues the four outer edges of its quadrilateral. The
+    // instack flags keep each edge slot on the stack at most once, so the stack
+    // never outgrows its 3*ntri entries
+    int32_t stack_top = 0;
+    int32_t nflip = 0;
+    memset(instack, 0, (size_t)ntri * 3 * sizeof(int32_t));
+    for (int32_t s = 0; s < ntri * 3; s++) {
+        if (adj[s] > s / 3) { // seed each interior edge once (from its lower triangle)
+            instack[s] = 1;
+            stack[stack_top++] = s;
+        }
+    }
+    while (stack_top > 0) {
+        int32_t s = stack[--stack_top];
+        instack[s] = 0;
+        int32_t t = s / 3;
+        int32_t e = s % 3;
+        int32_t u = adj[s];
+        if (u < 0) {
+            continue;
+        }
+        int32_t a = tri[t * 3 + e];
+        int32_t b = tri[t * 3 + (e + 1) % 3];
+        int32_t c = tri[t * 3 + (e + 2) % 3];
+        if (nseg > 0) {
+            int64_t key = a < b ? (((int64_t)a << 32) | (uint32_t)b) : (((int64_t)b << 32) | (uint32_t)a);
+            uint64_t h = ((uint64_t)key ^ ((uint64_t)key >> 29)) * 0x9E3779B97F4A7C15ull;
+            int32_t slot = (int32_t)(h & (uint64_t)(seg_size - 1));
+            while (skeys[slot] != -1 && skeys[slot] != key) {
+                slot = (slot + 1) & (seg_size - 1);
+            }
+            if (skeys[slot] == key) {
+                continue; // constrained edge
+            }
+        }
+        int32_t f = 0;
+        while (f < 3 && !(tri[u * 3 + f] == b && tri[u * 3 + (f + 1) % 3] == a)) {
+            f++;
+        }
+        if (f == 3) {
+            continue; // should not happen: the adjacency is inconsistent
+        }
+        int32_t d = tri[u * 3 + (f + 2) % 3];
+        if (tri_ins_incircle((double *)&pts[a * 2], (double *)&pts[b * 2],
+                             (double *)&pts[c * 2], (double *)&pts[d * 2]) <= 0.0) {
+            continue; // edge is locally Delaunay
+        }
+        // Flip the edge a-b to c-d: the quad a, d, b, c (counterclockwise) becomes
+        // the triangles t = (a, d, c) and u = (d, b, c)
+        nflip++;
+        int32_t tbc = adj[t * 3 + (e + 1) % 3];
+        int32_t tca = adj[t * 3 + (e + 2) % 3];
+        int32_t uad = adj[u * 3 + (f + 1) % 3];
+        int32_t udb = adj[u * 3 + (f + 2) % 3];
+        tri[t * 3] = a;
+        tri[t * 3 + 1] = d;
+        tri[t * 3 + 2] = c;
+        adj[t * 3] = uad;
+        adj[t * 3 + 1] = u;
+        adj[t * 3 + 2] = tca;
+        tri[u * 3] = d;
+        tri[u * 3 + 1] = b;
+        tri[u * 3 + 2] = c;
+        adj[u * 3] = udb;
+        adj[u * 3 + 1] = tbc;
+        adj[u * 3 + 2] = t;
+        if (uad >= 0) { // the neighbor across a-d now borders t
+            for (int32_t g = 0; g < 3; g++) {
+                if (tri[uad * 3 + g] == d && tri[uad * 3 + (g + 1) % 3] == a) {
+                    adj[uad * 3 + g] = t;
+                    break;
+                }
+            }
+        }
+        if (tbc >= 0) { // the neighbor across b-c now borders u
+            for (int32_t g = 0; g < 3; g++) {
+                if (tri[tbc * 3 + g] == c && tri[tbc * 3 + (g + 1) % 3] == b) {
+                    adj[tbc * 3 + g] = u;
+                    break;
+                }
+            }
+        }
+        // re-queue the four outer edges of the flipped quadrilateral
+        int32_t requeue[4] = {t * 3, t * 3 + 2, u * 3, u * 3 + 1};
+        for (int32_t g = 0; g < 4; g++) {
+            int32_t q = requeue[g];
+            if (adj[q] >= 0 && instack[q] == 0) {
+                instack[q] = 1;
+                stack[stack_top++] = q;
+            }
+        }
+    }
+
+    // Install the moved coordinates and the flipped connectivity (counts unchanged)
+    memcpy(out->pointlist, coords, (size_t)n * 2 * sizeof(double));
+    memcpy(out->trianglelist, tri, (size_t)ntri * 3 * sizeof(int32_t));
+    if (out->neighborlist != NULL) {
+        // adj[t*3+e] holds the neighbor across the edge (e, e+1), whereas Triangle
+        // stores the neighbor opposite corner e, i.e., across the edge (e+1, e+2)
+        for (int32_t t = 0; t < ntri; t++) {
+            for (int32_t e = 0; e < 3; e++) {
+                out->neighborlist[t * 3 + (e + 2) % 3] = adj[t * 3 + e];
+            }
+        }
+    }
+    if (nflip > 0) {
+        // a flipped diagonal is no longer an edge of the mesh; drop the stale list
+        if (out->edgelist != NULL) {
+            free(out->edgelist);
+            out->edgelist = NULL;
+        }
+        if (out->edgemarkerlist != NULL) {
+            free(out->edgemarkerlist);
+            out->edgemarkerlist = NULL;
+        }
+        out->numberofedges = 0;
+    }
+    free(arena);
+    return TRITET_SUCCESS;
+}
+
+int32_t tri_voronoi_from_delaunay(struct ExtTrigen *trigen) {
+    if (trigen == NULL) {
+        return TRITET_ERROR_NULL_DATA;
+    }
+    struct triangulateio *out = &trigen->output;
+    if (out->pointlist == NULL || out->trianglelist == NULL ||
+        out->numberoftriangles < 1 || out->numberofcorners != 3) {
+        return TRITET_ERROR_NO_TRIANGULATION;
+    }
+    int32_t ntri = out->numberoftriangles;
+    int32_t const *tri = out->trianglelist;
+    double const *pts = out->pointlist;
+
+    // Working arrays for the adjacency (edge table plus neighbor map)
+    int32_t table_size = 1;
+    while (table_size < 6 * ntri) {
+        table_size <<= 1;
+    }
+    size_t size_keys = (size_t)table_size * sizeof(int64_t);
+    size_t size_i32 = ((size_t)ntri * 3 + (size_t)table_size) * sizeof(int32_t);
+    char *arena = (char *)malloc(size_keys + size_i32);
+    if (arena == NULL) {
+        return TRITET_ERROR_NULL_DATA;
+    }
+    int64_t *keys = (int64_t *)arena;
+    int32_t *adj = (int32_t *)(arena + size_keys);
+    int32_t *vals = adj + (size_t)ntri * 3;
+    tri_build_adjacency(tri, ntri, adj, keys, vals, table_size);
+
+    // Count the Voronoi edges: one per Delaunay edge (the hull edges dualize to rays)
+    int32_t nedge = 0;
+    for (int32_t t = 0; t < ntri; t++) {
+        for (int32_t e = 0; e < 3; e++) {
+            int32_t nb = adj[t * 3 + e];
+            if (nb < 0 || t < nb) {
+                nedge++;
+            }
+        }
+    }
+
+    // Reserve (or recycle) the Voronoi arrays
+    if (ntri > trigen->vor_point_capacity) {
+        if (trigen->voronoi.pointlist != NULL) {
+            free(trigen->voronoi.pointlist);
+        }
+        trigen->voronoi.pointlist = (double *)malloc((size_t)ntri * 2 * sizeof(double));
+        if (trigen->voronoi.pointlist == NULL) {
+            trigen->vor_point_capacity = 0;
+            free(arena);
+            return TRITET_ERROR_NULL_DATA;
+        }
+        trigen->vor_point_capacity = ntri;
+    }
+    if (nedge > trigen->vor_edge_capacity) {
+        if (trigen->voronoi.edgelist != NULL) {
+            free(trigen->voronoi.edgelist);
+        }
+        if (trigen->voronoi.normlist != NULL) {
+            free(trigen->voronoi.normlist);
+        }
+        trigen->voronoi.edgelist = (int32_t *)malloc((size_t)nedge * 2 * sizeof(int32_t));
+        trigen->voronoi.normlist = (double *)malloc((size_t)nedge * 2 * sizeof(double));
+        if (trigen->voronoi.edgelist == NULL || trigen->voronoi.normlist == NULL) {
+            trigen->vor_edge_capacity = 0;
+            free(arena);
+            return TRITET_ERROR_NULL_DATA;
+        }
+        trigen->vor_edge_capacity = nedge;
+    }
+
+    // Circumcenters of all triangles (the dual Voronoi points). The loop body is
+    // branch-free and works on contiguous arrays so that the compiler can vectorize it
+    double *vpt = trigen->voronoi.pointlist;
+    for (int32_t t = 0; t < ntri; t++) {
+        double ax = pts[tri[t * 3] * 2];
+        double ay = pts[tri[t * 3] * 2 + 1];
+        double bx = pts[tri[t * 3 + 1] * 2] - ax;
+        double by = pts[tri[t * 3 + 1] * 2 + 1] - ay;
+        double cx = pts[tri[t * 3 + 2] * 2] - ax;
+        double cy = pts[tri[t * 3 + 2] * 2 + 1] - ay;
+        double bl = bx * bx + by * by;
+        double cl = cx * cx + cy * cy;
+        double d = 0.5 / (bx * cy - by * cx);
+        vpt[t * 2] = ax + (cy * bl - by * cl) * d;
+        vpt[t * 2 + 1] = ay + (bx * cl - cx * bl) * d;
+    }
+
+    // Dual edges: interior Delaunay edges connect two circumcenters; hull edges dualize
+    // to infinite rays along the outward normal of the hull edge
+    int32_t *ve = trigen->voronoi.edgelist;
+    double *vn = trigen->voronoi.normlist;
+    int32_t k = 0;
+    for (int32_t t = 0; t < ntri; t++) {
+        for (int32_t e = 0; e < 3; e++) {
+            int32_t nb = adj[t * 3 + e];
+            if (nb < 0) {
+                int32_t a = tri[t * 3 + e];
+                int32_t b = tri[t * 3 + (e + 1) % 3];
+                ve[k * 2] = t;
+                ve[k * 2 + 1] = -1;
+                vn[k * 2] = pts[b * 2 + 1] - pts[a * 2 + 1];
+                vn[k * 2 + 1] = pts[a * 2] - pts[b * 2];
+                k++;
+            } else if (t < nb) {
+                ve[k * 2] = t;
+                ve[k * 2 + 1] = nb;
+                vn[k * 2] = 0.0;
+                vn[k * 2 + 1] = 0.0;
+                k++;
+            }
+        }
+    }
+    trigen->voronoi.numberofpoints = ntri;
+    trigen->voronoi.numberofedges = nedge;
+    tri_clear_voronoi_split(trigen);
+    free(arena);
+    return TRITET_SUCCESS;
+}
+
+int32_t tri_set_output_mesh(struct ExtTrigen *trigen,
+                            int32_t npoint, double const *coords, int32_t const *point_markers,
+                            int32_t ntriangle, int32_t const *triangles, int32_t const *attributes,
+                            int32_t nsegment, int32_t const *segments, int32_t const *segment_markers) {
+    if (trigen == NULL || coords == NULL || point_markers == NULL || triangles == NULL || attributes == NULL) {
+        return TRITET_ERROR_NULL_DATA;
+    }
+    if (npoint < 3 || ntriangle < 1) {
+        return TRITET_ERROR_INVALID_BATCH_COUNT;
+    }
+
+    // Replace the previous output (the externally assembled arrays do not follow the
+    // high-water capacities, so the retained buffers cannot be recycled here)
+    tri_release_output(trigen);
+
+    // Points and triangles (the attributes are stored as double, following Triangle)
+    trigen->output.pointlist = (double *)malloc(npoint * 2 * sizeof(double));
+    trigen->output.pointmarkerlist = (int32_t *)malloc(npoint * sizeof(int32_t));
+    trigen->output.trianglelist = (int32_t *)malloc(ntriangle * 3 * sizeof(int32_t));
+    trigen->output.triangleattributelist = (double *)malloc(ntriangle * sizeof(double));
+    if (trigen->output.pointlist == NULL || trigen->output.pointmarkerlist == NULL ||
+        trigen->output.trianglelist == NULL || trigen->output.triangleattributelist == NULL) {
+        free_triangle_data(&trigen->output);
+        return TRITET_ERROR_NULL_DATA;
+    }
+    memcpy(trigen->output.pointlist, coords, npoint * 2 * sizeof(double));
+    memcpy(trigen->output.pointmarkerlist, point_markers, npoint * sizeof(int32_t));
+    memcpy(trigen->output.trianglelist, triangles, ntriangle * 3 * sizeof(int32_t));
+    for (int32_t i = 0; i < ntriangle; i++) {
+        trigen->output.triangleattributelist[i] = attributes[i];
+    }
+    trigen->output.numberofpoints = npoint;
+    trigen->output.numberoftriangles = ntriangle;
+    trigen->output.numberofcorners = 3;
+    trigen->output.numberoftriangleattributes = 1;
+
+    // Segments (optional)
+    if (nsegment > 0 && segments != NULL && segment_markers != NULL) {
+        trigen->output.segmentlist = (int32_t *)malloc(nsegment * 2 * sizeof(int32_t));
+        trigen->output.segmentmarkerlist = (int32_t *)malloc(nsegment * sizeof(int32_t));
+        if (trigen->output.segmentlist == NULL || trigen->output.segmentmarkerlist == NULL) {
+            free_triangle_data(&trigen->output);
+            return TRITET_ERROR_NULL_DATA;
+        }
+        memcpy(trigen->output.segmentlist, segments, nsegment * 2 * sizeof(int32_t));
+        memcpy(trigen->output.segmentmarkerlist, segment_markers, nsegment * sizeof(int32_t));
+        trigen->output.numberofsegments = nsegment;
+    }
+    return TRITET_SUCCESS;
+}
+
+int32_t tri_adopt_output_as_input(struct ExtTrigen *trigen) {
+    if (trigen == NULL) {
+        return TRITET_ERROR_NULL_DATA;
+    }
+    if (trigen->output.pointlist == NULL || trigen->output.trianglelist == NULL ||
+        trigen->output.numberoftriangles < 1) {
+        return TRITET_ERROR_NO_TRIANGULATION;
+    }
+
+    // The previous input (region and hole definitions included) is released; the output
+    // arrays then move pointer-wise: the struct assignment transfers every pointer and
+    // count, and zeroing the output afterwards leaves the input as the sole owner.
+    // Note: the output never aliases input.holelist/regionlist here, because every run
+    // clears these aliases right after triangulate (see, e.g., tri_run_triangulate)
+    free_triangle_data(&trigen->input);
+    trigen->input = trigen->output;
+    zero_triangle_data(&trigen->output);
+
+    // the retained (high-water) buffers now belong to the input; the next run must
+    // allocate fresh output arrays
+    trigen->out_point_capacity = 0;
+    trigen->out_triangle_capacity = 0;
+
+    return TRITET_SUCCESS;
+}
+
 int32_t tri_out_npoint(struct ExtTrigen *trigen) {
     if (trigen == NULL) {
         return 0;
@@ -417,7 +1498,7 @@ double tri_out_point(struct ExtTrigen *trigen, int32_t index, int32_t dim) {
         return 0.0;
     }
     if (index < trigen->output.numberofpoints && (dim == 0 || dim == 1)) {
-        return trigen->output.pointlist[index * 2 + dim];
+        return trigen->output.pointlist[(size_t)index * 2 + dim];
     } else {
         return 0.0;
     }
@@ -439,7 +1520,7 @@ int32_t tri_out_segment_point(struct ExtTrigen *trigen, int32_t index, int32_t s
         return 0;
     }
     if (index < trigen->output.numberofsegments && (side == 0 || side == 1)) {
-        return trigen->output.segmentlist[index * 2 + side];
+        return trigen->output.segmentlist[(size_t)index * 2 + side];
     } else {
         return 0;
     }
@@ -461,12 +1542,23 @@ int32_t tri_out_cell_point(struct ExtTrigen *trigen, int32_t index, int32_t corn
         return 0;
     }
     if (index < trigen->output.numberoftriangles && corner < trigen->output.numberofcorners) {
-        return trigen->output.trianglelist[index * trigen->output.numberofcorners + corner];
+        return trigen->output.trianglelist[(size_t)index * trigen->output.numberofcorners + corner];
     } else {
         return 0;
     }
 }
 
+int32_t tri_out_cell_neighbor(struct ExtTrigen *trigen, int32_t index, int32_t side) {
+    if (trigen == NULL || trigen->output.neighborlist == NULL) {
+        return -1;
+    }
+    if (index < trigen->output.numberoftriangles && side >= 0 && side < 3) {
+        return trigen->output.neighborlist[(size_t)index * 3 + side];
+    } else {
+        return -1;
+    }
+}
+
 int32_t tri_out_cell_attribute(struct ExtTrigen *trigen, int32_t index) {
     if (trigen == NULL) {
         return 0;
@@ -478,6 +1570,254 @@ int32_t tri_out_cell_attribute(struct ExtTrigen *trigen, int32_t index) {
     }
 }
 
+const double *tri_out_point_list(struct ExtTrigen *trigen) {
+    if (trigen == NULL) {
+        return NULL;
+    }
+    return trigen->output.pointlist;
+}
+
+const int32_t *tri_out_point_marker_list(struct ExtTrigen *trigen) {
+    if (trigen == NULL) {
+        return NULL;
+    }
+    return trigen->output.pointmarkerlist;
+}
+
+const int32_t *tri_out_segment_list(struct ExtTrigen *trigen) {
+    if (trigen == NULL) {
+        return NULL;
+    }
+    return trigen->output.segmentlist;
+}
+
+const int32_t *tri_out_segment_marker_list(struct ExtTrigen *trigen) {
+    if (trigen == NULL) {
+        return NULL;
+    }
+    return trigen->output.segmentmarkerlist;
+}
+
+const int32_t *tri_out_cell_point_list(struct ExtTrigen *trigen) {
+    if (trigen == NULL) {
+        return NULL;
+    }
+    return trigen->output.trianglelist;
+}
+
+const int32_t *tri_out_neighbor_list(struct ExtTrigen *trigen) {
+    if (trigen == NULL) {
+        return NULL;
+    }
+    return trigen->output.neighborlist;
+}
+
+int32_t tri_out_nedge(struct ExtTrigen *trigen) {
+    if (trigen == NULL) {
+        return 0;
+    }
+    if (trigen->output.edgelist == NULL) {
+        return 0;
+    }
+    return trigen->output.numberofedges;
+}
+
+int32_t tri_out_edge_point(struct ExtTrigen *trigen, int32_t index, int32_t side) {
+    if (trigen == NULL) {
+        return 0;
+    }
+    if (trigen->output.edgelist != NULL && index < trigen->output.numberofedges && (side == 0 || side == 1)) {
+        return trigen->output.edgelist[(size_t)index * 2 + (size_t)side];
+    } else {
+        return 0;
+    }
+}
+
+int32_t tri_out_edge_marker(struct ExtTrigen *trigen, int32_t index) {
+    if (trigen == NULL) {
+        return 0;
+    }
+    if (trigen->output.edgemarkerlist != NULL && index < trigen->output.numberofedges) {
+        return trigen->output.edgemarkerlist[index];
+    } else {
+        return 0;
+    }
+}
+
+const int32_t *tri_out_edge_list(struct ExtTrigen *trigen) {
+    if (trigen == NULL) {
+        return NULL;
+    }
+    return trigen->output.edgelist;
+}
+
+const int32_t *tri_out_edge_marker_list(struct ExtTrigen *trigen) {
+    if (trigen == NULL) {
+        return NULL;
+    }
+    return trigen->output.edgemarkerlist;
+}
+
+// Minimum interior angle (degrees) of the triangle with corners a, b, c; the angles
+// follow from the edge vectors meeting at each corner. Returns zero for a degenerate
+// (zero-length edge) triangle
+static double tri_min_angle(double const *pa, double const *pb, double const *pc) {
+    double const *corner[3] = {pa, pb, pc};
+    double worst = 180.0;
+    for (int32_t k = 0; k < 3; k++) {
+        double const *a = corner[k];
+        double const *b = corner[(k + 1) % 3];
+        double const *c = corner[(k + 2) % 3];
+        double ux = b[0] - a[0];
+        double uy = b[1] - a[1];
+        double vx = c[0] - a[0];
+        double vy = c[1] - a[1];
+        double len = sqrt((ux * ux + uy * uy) * (vx * vx + vy * vy));
+        if (len <= 0.0) {
+            return 0.0; // an edge has zero length
+        }
+        double cosang = (ux * vx + uy * vy) / len;
+        cosang = cosang > 1.0 ? 1.0 : (cosang < -1.0 ? -1.0 : cosang);
+        double angle = acos(cosang) * (180.0 / 3.14159265358979323846);
+        if (angle < worst) {
+            worst = angle;
+        }
+    }
+    return worst;
+}
+
+// the quality of a cell: its minimum angle from the first three corners
+// (the corner positions also carry the geometry of quadratic triangles)
+static double tri_cell_quality(struct ExtTrigen *trigen, int32_t index) {
+    double const *pts = trigen->output.pointlist;
+    int32_t const *tri = &trigen->output.trianglelist[(size_t)index * (size_t)trigen->output.numberofcorners];
+    return tri_min_angle(&pts[(size_t)tri[0] * 2], &pts[(size_t)tri[1] * 2], &pts[(size_t)tri[2] * 2]);
+}
+
+int32_t tri_out_quality_histogram(struct ExtTrigen *trigen, int32_t nbin, int64_t *histogram, double *min_quality, double *max_quality) {
+    if (trigen == NULL || histogram == NULL || min_quality == NULL || max_quality == NULL) {
+        return TRITET_ERROR_NULL_DATA;
+    }
+    if (nbin < 1) {
+        return TRITET_ERROR_INVALID_BATCH_COUNT;
+    }
+    if (trigen->output.pointlist == NULL || trigen->output.trianglelist == NULL ||
+        trigen->output.numberoftriangles < 1) {
+        return TRITET_ERROR_NO_TRIANGULATION;
+    }
+    for (int32_t bin = 0; bin < nbin; bin++) {
+        histogram[bin] = 0;
+    }
+    double qmin = 180.0;
+    double qmax = 0.0;
+    int32_t ncell = trigen->output.numberoftriangles;
+    for (int32_t t = 0; t < ncell; t++) {
+        double quality = tri_cell_quality(trigen, t);
+        int32_t bin = (int32_t)(quality * (double)nbin / 60.0);
+        bin = bin < 0 ? 0 : (bin >= nbin ? nbin - 1 : bin);
+        histogram[bin] += 1;
+        qmin = quality < qmin ? quality : qmin;
+        qmax = quality > qmax ? quality : qmax;
+    }
+    *min_quality = qmin;
+    *max_quality = qmax;
+    return TRITET_SUCCESS;
+}
+
+int32_t tri_out_worst_cells(struct ExtTrigen *trigen, int32_t nworst, int32_t *cells, double *qualities, int32_t *count) {
+    if (trigen == NULL || cells == NULL || qualities == NULL || count == NULL) {
+        return TRITET_ERROR_NULL_DATA;
+    }
+    if (nworst < 1) {
+        return TRITET_ERROR_INVALID_BATCH_COUNT;
+    }
+    if (trigen->output.pointlist == NULL || trigen->output.trianglelist == NULL ||
+        trigen->output.numberoftriangles < 1) {
+        return TRITET_ERROR_NO_TRIANGULATION;
+    }
+    int32_t nkeep = 0;
+    int32_t ncell = trigen->output.numberoftriangles;
+    for (int32_t t = 0; t < ncell; t++) {
+        double quality = tri_cell_quality(trigen, t);
+        if (nkeep == nworst && quality >= qualities[nkeep - 1]) {
+            continue; // not worse than the kept worst-of-the-best
+        }
+        // insertion into the (short) ascending list
+        int32_t i = nkeep < nworst ? nkeep : nworst - 1;
+        while (i > 0 && qualities[i - 1] > quality) {
+            qualities[i] = qualities[i - 1];
+            cells[i] = cells[i - 1];
+            i--;
+        }
+        qualities[i] = quality;
+        cells[i] = t;
+        nkeep = nkeep < nworst ? nkeep + 1 : nkeep;
+    }
+    *count = nkeep;
+    return TRITET_SUCCESS;
+}
+
+int32_t tri_out_voronoi_edge_split(struct ExtTrigen *trigen,
+                                   int32_t const **finite_edges, int32_t *n_finite,
+                                   int32_t const **infinite_edges, int32_t *n_infinite) {
+    if (trigen == NULL || finite_edges == NULL || n_finite == NULL || infinite_edges == NULL || n_infinite == NULL) {
+        return TRITET_ERROR_NULL_DATA;
+    }
+    int32_t nedge = trigen->voronoi.numberofedges;
+    if (trigen->voronoi.edgelist == NULL || nedge < 1) {
+        return TRITET_ERROR_NO_VORONOI;
+    }
+
+    // Build the split once (one sequential pass) and keep it until the next run
+    if (trigen->vor_finite_edges == NULL) {
+        int32_t *indices = (int32_t *)malloc((size_t)nedge * sizeof(int32_t));
+        if (indices == NULL) {
+            return TRITET_ERROR_NULL_DATA;
+        }
+        // the finite indices grow from the front and the rays from the back, so one
+        // allocation holds both sets
+        int32_t lo = 0;
+        int32_t hi = nedge;
+        for (int32_t index = 0; index < nedge; index++) {
+            if (trigen->voronoi.edgelist[(size_t)index * 2 + 1] == -1) {
+                indices[--hi] = index;
+            } else {
+                indices[lo++] = index;
+            }
+        }
+        // reverse the ray set so that both sets are in ascending order
+        for (int32_t i = hi, j = nedge - 1; i < j; i++, j--) {
+            int32_t swap = indices[i];
+            indices[i] = indices[j];
+            indices[j] = swap;
+        }
+        trigen->vor_finite_edges = indices;
+        trigen->vor_infinite_edges = indices + lo;
+        trigen->vor_n_finite_edge = lo;
+        trigen->vor_n_infinite_edge = nedge - lo;
+    }
+
+    *finite_edges = trigen->vor_finite_edges;
+    *n_finite = trigen->vor_n_finite_edge;
+    *infinite_edges = trigen->vor_infinite_edges;
+    *n_infinite = trigen->vor_n_infinite_edge;
+    return TRITET_SUCCESS;
+}
+
+const int32_t *tri_out_voronoi_edge_list(struct ExtTrigen *trigen) {
+    if (trigen == NULL) {
+        return NULL;
+    }
+    return trigen->voronoi.edgelist;
+}
+
+const double *tri_out_voronoi_direction_list(struct ExtTrigen *trigen) {
+    if (trigen == NULL) {
+        return NULL;
+    }
+    return trigen->voronoi.normlist;
+}
+
 int32_t tri_out_voronoi_npoint(struct ExtTrigen *trigen) {
     if (trigen == NULL) {
         return 0;
@@ -490,7 +1830,7 @@ double tri_out_voronoi_point(struct ExtTrigen *trigen, int32_t index, int32_t di
         return 0.0;
     }
     if (index < trigen->voronoi.numberofpoints && (dim == 0 || dim == 1)) {
-        return trigen->voronoi.pointlist[index * 2 + dim];
+        return trigen->voronoi.pointlist[(size_t)index * 2 + dim];
     } else {
         return 0.0;
     }
@@ -508,7 +1848,7 @@ int32_t tri_out_voronoi_edge_point(struct ExtTrigen *trigen, int32_t index, int3
         return 0;
     }
     if (index < trigen->voronoi.numberofedges && (side == 0 || side == 1)) {
-        return trigen->voronoi.edgelist[index * 2 + side];
+        return trigen->voronoi.edgelist[(size_t)index * 2 + side];
     } else {
         return 0;
     }
@@ -519,8 +1859,8 @@ double tri_out_voronoi_edge_point_b_direction(struct ExtTrigen *trigen, int32_t
         return 0.0;
     }
     if (index < trigen->voronoi.numberofedges && (dim == 0 || dim == 1)) {
-        if (trigen->voronoi.edgelist[index * 2 + 1] == -1) {
-            return trigen->voronoi.normlist[index * 2 + dim];
+        if (trigen->voronoi.edgelist[(size_t)index * 2 + 1] == -1) {
+            return trigen->voronoi.normlist[(size_t)index * 2 + dim];
         } else {
             return 0.0;
         }
@@ -528,3 +1868,16 @@ double tri_out_voronoi_edge_point_b_direction(struct ExtTrigen *trigen, int32_t
         return 0.0;
     }
 }
+
+void tri_out_pool_stats(struct ExtTrigen *trigen, struct TriPoolStats *stats) {
+    if (trigen == NULL || stats == NULL) {
+        return;
+    }
+    stats->vertices_items = trigen->output.poolvertices_items;
+    stats->vertices_max_items = trigen->output.poolvertices_maxitems;
+    stats->triangles_items = trigen->output.pooltriangles_items;
+    stats->triangles_max_items = trigen->output.pooltriangles_maxitems;
+    stats->subsegs_items = trigen->output.poolsubsegs_items;
+    stats->subsegs_max_items = trigen->output.poolsubsegs_maxitems;
+    stats->pool_peak_bytes = trigen->output.pool_peak_bytes;
+}
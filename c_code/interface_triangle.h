@@ -15,6 +15,19 @@ struct ExtTrigen {
     struct triangulateio input;
     struct triangulateio output;
     struct triangulateio voronoi;
+    // high-water capacities (number of entities) of the recycled output arrays;
+    // see tri_reserve_output in interface_triangle.c
+    int32_t out_point_capacity;
+    int32_t out_triangle_capacity;
+    int32_t vor_point_capacity;
+    int32_t vor_edge_capacity;
+    // split of the Voronoi edges into the finite and the infinite (ray) index sets,
+    // built lazily by tri_out_voronoi_edge_split and cleared when the Voronoi data
+    // changes
+    int32_t *vor_finite_edges;
+    int32_t *vor_infinite_edges;
+    int32_t vor_n_finite_edge;
+    int32_t vor_n_infinite_edge;
 };
 
 struct ExtTrigen *tri_new_trigen(int32_t npoint, int32_t nsegment, int32_t nregion, int32_t nhole);
@@ -23,6 +36,10 @@ void tri_drop_trigen(struct ExtTrigen *trigen);
 
 int32_t tri_set_point(struct ExtTrigen *trigen, int32_t index, int32_t marker, double x, double y);
 
+int32_t tri_set_points_batch(struct ExtTrigen *trigen, int32_t npoint, double const *coords, int32_t const *markers);
+
+int32_t tri_set_segments_batch(struct ExtTrigen *trigen, int32_t nsegment, int32_t const *segments, int32_t const *markers);
+
 int32_t tri_set_segment(struct ExtTrigen *trigen, int32_t index, int32_t marker, int32_t a, int32_t b);
 
 int32_t tri_set_region(struct ExtTrigen *trigen, int32_t index, int32_t attribute, double x, double y, double max_area);
@@ -33,8 +50,39 @@ int32_t tri_run_delaunay(struct ExtTrigen *trigen, int32_t verbose);
 
 int32_t tri_run_voronoi(struct ExtTrigen *trigen, int32_t verbose);
 
+// Derives the Voronoi data (circumcenters and dual edges) from the output of a previous
+// Delaunay run, instead of re-running the whole triangulation
+int32_t tri_voronoi_from_delaunay(struct ExtTrigen *trigen);
+
 int32_t tri_run_triangulate(struct ExtTrigen *trigen, int32_t verbose, int32_t quadratic, int32_t allow_new_points_on_bry, double global_max_area, double global_min_angle);
 
+// Inserts points into an existing Delaunay triangulation (Bowyer-Watson), warm-starting
+// from the output data instead of re-triangulating from scratch. The points must fall
+// inside the convex hull and must not coincide with existing points.
+int32_t tri_insert_points(struct ExtTrigen *trigen, int32_t n, double const *coords);
+
+// Moves the existing vertex set to updated coordinates (n must equal the number of
+// output points), reusing the output triangle list as the starting triangulation and
+// restoring Delaunayhood with local (Lawson) edge flips only -- constrained segment
+// edges are never flipped. Fails with TRITET_ERROR_INVERTED_CELLS if a triangle
+// collapses or inverts at the new positions (a full retriangulation is then needed).
+int32_t tri_move_points(struct ExtTrigen *trigen, int32_t n, double const *coords);
+
+// Installs an externally assembled mesh into the output data, so that it can be accessed
+// by the tri_out_* functions. Used by the parallel (domain-decomposed) mesher, which
+// stitches the results of several triangulate() runs into one mesh.
+int32_t tri_set_output_mesh(struct ExtTrigen *trigen,
+                            int32_t npoint, double const *coords, int32_t const *point_markers,
+                            int32_t ntriangle, int32_t const *triangles, int32_t const *attributes,
+                            int32_t nsegment, int32_t const *segments, int32_t const *segment_markers);
+
+// Moves the output arrays of the previous run into the input pointer-wise (zero copies),
+// so that multi-stage pipelines (e.g., mesh, then re-triangulate the refined point set)
+// chain inside the C layer instead of round-tripping every array through the
+// tri_out_*/tri_set_* accessors. The previous input (region and hole definitions
+// included) is released and the output becomes empty
+int32_t tri_adopt_output_as_input(struct ExtTrigen *trigen);
+
 int32_t tri_out_npoint(struct ExtTrigen *trigen);
 
 int32_t tri_out_nsegment(struct ExtTrigen *trigen);
@@ -55,6 +103,61 @@ int32_t tri_out_cell_point(struct ExtTrigen *trigen, int32_t index, int32_t corn
 
 int32_t tri_out_cell_attribute(struct ExtTrigen *trigen, int32_t index);
 
+int32_t tri_out_cell_neighbor(struct ExtTrigen *trigen, int32_t index, int32_t side); // -1 means no neighbor
+
+const double *tri_out_point_list(struct ExtTrigen *trigen);
+
+const int32_t *tri_out_point_marker_list(struct ExtTrigen *trigen);
+
+const int32_t *tri_out_segment_list(struct ExtTrigen *trigen);
+
+const int32_t *tri_out_segment_marker_list(struct ExtTrigen *trigen);
+
+const int32_t *tri_out_cell_point_list(struct ExtTrigen *trigen);
+
+const int32_t *tri_out_neighbor_list(struct ExtTrigen *trigen);
+
+int32_t tri_out_nedge(struct ExtTrigen *trigen); // only filled by tri_run_triangulate (-e switch)
+
+int32_t tri_out_edge_point(struct ExtTrigen *trigen, int32_t index, int32_t side);
+
+int32_t tri_out_edge_marker(struct ExtTrigen *trigen, int32_t index);
+
+const int32_t *tri_out_edge_list(struct ExtTrigen *trigen);
+
+const int32_t *tri_out_edge_marker_list(struct ExtTrigen *trigen);
+
+// Histogram of the per-triangle quality (the minimum interior angle, in degrees):
+// nbin bins of equal width spanning [0, 60); larger angles land in the last bin, and
+// min_quality/max_quality receive the exact extremes. Computed in one sequential pass
+// over the output arrays, so gating a solver on mesh quality does not require
+// re-scanning the mesh through the per-element accessors
+int32_t tri_out_quality_histogram(struct ExtTrigen *trigen, int32_t nbin, int64_t *histogram, double *min_quality, double *max_quality);
+
+// Fills cells/qualities (both with nworst entries) with the (at most) nworst cells of
+// smallest quality (minimum angle, degrees), sorted worst first; count receives the
+// number of entries actually written
+int32_t tri_out_worst_cells(struct ExtTrigen *trigen, int32_t nworst, int32_t *cells, double *qualities, int32_t *count);
+
+// Splits the Voronoi edges into the finite and the infinite (ray) index sets in one
+// sequential pass over edgelist (an edge is a ray when its second endpoint is -1).
+// The split is built on the first call after a Voronoi run and cached until the next
+// run, so per-frame consumers pay the scan once. finite_edges/infinite_edges receive
+// pointers into the cached arrays (valid until the next run); n_finite/n_infinite
+// receive the set sizes
+int32_t tri_out_voronoi_edge_split(struct ExtTrigen *trigen,
+                                   int32_t const **finite_edges, int32_t *n_finite,
+                                   int32_t const **infinite_edges, int32_t *n_infinite);
+
+// Bulk access to the Voronoi edge endpoints (2 entries per edge; the second endpoint
+// is -1 for rays). The pointer remains valid until the next run
+const int32_t *tri_out_voronoi_edge_list(struct ExtTrigen *trigen);
+
+// Bulk access to the Voronoi ray directions (Triangle's normlist; 2 entries per edge,
+// only meaningful for the edges whose second endpoint is -1). The pointer remains
+// valid until the next run
+const double *tri_out_voronoi_direction_list(struct ExtTrigen *trigen);
+
 int32_t tri_out_voronoi_npoint(struct ExtTrigen *trigen);
 
 double tri_out_voronoi_point(struct ExtTrigen *trigen, int32_t index, int32_t dim);
@@ -65,4 +168,33 @@ int32_t tri_out_voronoi_edge_point(struct ExtTrigen *trigen, int32_t index, int3
 
 double tri_out_voronoi_edge_point_b_direction(struct ExtTrigen *trigen, int32_t index, int32_t dim);
 
+// Memory pool usage captured by the last run (Triangle's memorypool struct manages all
+// element storage), so container memory limits can be sized from the peak (high-water)
+// marks instead of trial and error
+struct TriPoolStats {
+    int64_t vertices_items;       // live items of the vertex pool at the end of the run
+    int64_t vertices_max_items;   // high-water mark of the vertex pool
+    int64_t triangles_items;      // live items of the triangle pool
+    int64_t triangles_max_items;  // high-water mark of the triangle pool
+    int64_t subsegs_items;        // live items of the subsegment pool
+    int64_t subsegs_max_items;    // high-water mark of the subsegment pool
+    int64_t pool_peak_bytes;      // approximate peak heap use of all pools (bytes)
+};
+
+// Copies the pool stats of the last run into the given struct (all zeros before any run)
+void tri_out_pool_stats(struct ExtTrigen *trigen, struct TriPoolStats *stats);
+
+// Batched robust predicates: each call evaluates n independent tests over packed point
+// arrays -- two doubles (x, y) per point, or three (x, y, height) for the 3D orientation
+// test, which operates on lifted points as in triangle.c's orient3d. The floating-point
+// filter runs as a flat branch-free loop over blocks of lanes (vectorizable by the
+// compiler); only the lanes whose error bound fails take the exact arithmetic path.
+// `result` receives the n signed determinants, with the same sign conventions as
+// counterclockwise, incircle, and orient3d in triangle.c
+void tri_orient2d_batch(int32_t n, double const *pa, double const *pb, double const *pc, double *result);
+
+void tri_incircle_batch(int32_t n, double const *pa, double const *pb, double const *pc, double const *pd, double *result);
+
+void tri_orient3d_batch(int32_t n, double const *pa, double const *pb, double const *pc, double const *pd, double *result);
+
 #endif // INTERFACE_TRIANGLE_H
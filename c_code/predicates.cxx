@@ -373,26 +373,46 @@
   Square(a1, _j, _1); \
   Two_Two_Sum(_j, _1, _l, _2, x5, x4, x3, x2)
 
+// dorival: for IEEE 754 arithmetic, `splitter', `epsilon', and the error
+// bounds are derivable at compile time, so they are constants now and
+// exactinit() only verifies them and sets the per-thread state below.
+// This makes the predicates reentrant: multiple meshers may run
+// concurrently from different threads.
 /* splitter = 2^ceiling(p / 2) + 1.  Used to split floats in half.           */
-static REAL splitter;
-static REAL epsilon;         /* = 2^(-p).  Used to estimate roundoff errors. */
+#ifdef SINGLE
+static constexpr REAL splitter = 4097.0;                      /* = 2^12 + 1 */
+static constexpr REAL epsilon = 5.9604644775390625e-08;       /* = 2^(-24)  */
+#else /* not SINGLE */
+static constexpr REAL splitter = 134217729.0;                 /* = 2^27 + 1 */
+static constexpr REAL epsilon = 1.1102230246251565e-16;       /* = 2^(-53)  */
+#endif /* not SINGLE */
 /* A set of coefficients used to calculate maximum roundoff errors.          */
-static REAL resulterrbound;
-static REAL ccwerrboundA, ccwerrboundB, ccwerrboundC;
-static REAL o3derrboundA, o3derrboundB, o3derrboundC;
-static REAL iccerrboundA, iccerrboundB, iccerrboundC;
-static REAL isperrboundA, isperrboundB, isperrboundC;
-
-// Options to choose types of geometric computtaions. 
+static constexpr REAL resulterrbound = (3.0 + 8.0 * epsilon) * epsilon;
+static constexpr REAL ccwerrboundA = (3.0 + 16.0 * epsilon) * epsilon;
+static constexpr REAL ccwerrboundB = (2.0 + 12.0 * epsilon) * epsilon;
+static constexpr REAL ccwerrboundC = (9.0 + 64.0 * epsilon) * epsilon * epsilon;
+static constexpr REAL o3derrboundA = (7.0 + 56.0 * epsilon) * epsilon;
+static constexpr REAL o3derrboundB = (3.0 + 28.0 * epsilon) * epsilon;
+static constexpr REAL o3derrboundC = (26.0 + 288.0 * epsilon) * epsilon * epsilon;
+static constexpr REAL iccerrboundA = (10.0 + 96.0 * epsilon) * epsilon;
+static constexpr REAL iccerrboundB = (4.0 + 48.0 * epsilon) * epsilon;
+static constexpr REAL iccerrboundC = (44.0 + 576.0 * epsilon) * epsilon * epsilon;
+static constexpr REAL isperrboundA = (16.0 + 224.0 * epsilon) * epsilon;
+static constexpr REAL isperrboundB = (5.0 + 72.0 * epsilon) * epsilon;
+static constexpr REAL isperrboundC = (71.0 + 1408.0 * epsilon) * epsilon * epsilon;
+
+// Options to choose types of geometric computtaions.
 // Added by H. Si, 2012-08-23.
-static int  _use_inexact_arith; // -X option.
-static int  _use_static_filter; // Default option, disable it by -X1
+// dorival: thread-local because they are set per run by exactinit()
+static thread_local int  _use_inexact_arith; // -X option.
+static thread_local int  _use_static_filter; // Default option, disable it by -X1
 
-// Static filters for orient3d() and insphere(). 
+// Static filters for orient3d() and insphere().
 // They are pre-calcualted and set in exactinit().
 // Added by H. Si, 2012-08-23.
-static REAL o3dstaticfilter;
-static REAL ispstaticfilter;
+// dorival: thread-local because they depend on the bounding box of the run
+static thread_local REAL o3dstaticfilter;
+static thread_local REAL ispstaticfilter;
 
 
 
@@ -591,40 +611,31 @@ int exactinit(int verbose, int noexact, int nofilter, REAL maxx, REAL maxy,
   test_double(verbose);
 #endif
 
-  every_other = 1;
-  half = 0.5;
-  epsilon = 1.0;
-  splitter = 1.0;
-  check = 1.0;
-  /* Repeatedly divide `epsilon' by two until it is too small to add to    */
+  /* Repeatedly divide `eps' by two until it is too small to add to        */
   /*   one without causing roundoff.  (Also check if the sum is equal to   */
   /*   the previous sum, for machines that round up instead of using exact */
   /*   rounding.  Not that this library will work on such machines anyway. */
+  // dorival: `epsilon' and `splitter' are compile-time constants now; this
+  // loop only verifies that the arithmetic really is IEEE 754
+  REAL eps, split;
+  every_other = 1;
+  half = 0.5;
+  eps = 1.0;
+  split = 1.0;
+  check = 1.0;
   do {
     lastcheck = check;
-    epsilon *= half;
+    eps *= half;
     if (every_other) {
-      splitter *= 2.0;
+      split *= 2.0;
     }
     every_other = !every_other;
-    check = 1.0 + epsilon;
+    check = 1.0 + eps;
   } while ((check != 1.0) && (check != lastcheck));
-  splitter += 1.0;
-
-  /* Error bounds for orientation and incircle tests. */
-  resulterrbound = (3.0 + 8.0 * epsilon) * epsilon;
-  ccwerrboundA = (3.0 + 16.0 * epsilon) * epsilon;
-  ccwerrboundB = (2.0 + 12.0 * epsilon) * epsilon;
-  ccwerrboundC = (9.0 + 64.0 * epsilon) * epsilon * epsilon;
-  o3derrboundA = (7.0 + 56.0 * epsilon) * epsilon;
-  o3derrboundB = (3.0 + 28.0 * epsilon) * epsilon;
-  o3derrboundC = (26.0 + 288.0 * epsilon) * epsilon * epsilon;
-  iccerrboundA = (10.0 + 96.0 * epsilon) * epsilon;
-  iccerrboundB = (4.0 + 48.0 * epsilon) * epsilon;
-  iccerrboundC = (44.0 + 576.0 * epsilon) * epsilon * epsilon;
-  isperrboundA = (16.0 + 224.0 * epsilon) * epsilon;
-  isperrboundB = (5.0 + 72.0 * epsilon) * epsilon;
-  isperrboundC = (71.0 + 1408.0 * epsilon) * epsilon * epsilon;
+  split += 1.0;
+  if (eps != epsilon || split != splitter) {
+    return 1; // error: the arithmetic is not IEEE 754 round-to-nearest
+  }
 
   // Set TetGen options.  Added by H. Si, 2012-08-23.
   _use_inexact_arith = noexact;
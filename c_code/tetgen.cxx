@@ -31253,6 +31253,49 @@ int tetrahedralize(tetgenbehavior *b, tetgenio *in, tetgenio *out,
 
   tv[11] = clock();
 
+  // dorival / capture the phase timings and counters for telemetry / BEGIN
+  if (out != (tetgenio *) NULL) {
+    out->stats.delaunay_seconds = ((REAL)(tv[2] - tv[1])) / cps;
+    out->stats.surface_mesh_seconds = ((REAL)(tv[3] - tv[2])) / cps;
+    out->stats.sizing_seconds = ((REAL)(tv[4] - tv[3])) / cps;
+    out->stats.recovery_seconds = ((REAL)(tv[8] - tv[4])) / cps;
+    out->stats.refinement_seconds = ((REAL)(tv[9] - tv[8])) / cps;
+    out->stats.optimization_seconds = ((REAL)(tv[10] - tv[9])) / cps;
+    out->stats.output_seconds = ((REAL)(tv[11] - tv[10])) / cps;
+    out->stats.total_seconds = ((REAL)(tv[11] - tv[0])) / cps;
+    out->stats.points_inserted = (long)out->numberofpoints -
+                                 (long)in->numberofpoints;
+    out->stats.steiner_on_segments = m.st_segref_count;
+    out->stats.steiner_on_facets = m.st_facref_count;
+    out->stats.steiner_in_volume = m.st_volref_count;
+    out->stats.flips = m.flip14count + m.flip26count + m.flipn2ncount +
+                       m.flip23count + m.flip32count + m.flip44count +
+                       m.flip41count + m.flip31count + m.flip22count;
+    out->stats.duplicated_vertices = m.dupverts;
+    out->stats.unused_vertices = m.unuverts;
+    out->pool_stats.points_items = m.points->items;
+    out->pool_stats.points_max_items = m.points->maxitems;
+    out->pool_stats.tetrahedrons_items = m.tetrahedrons->items;
+    out->pool_stats.tetrahedrons_max_items = m.tetrahedrons->maxitems;
+    out->pool_stats.pool_peak_bytes =
+      m.points->maxitems * m.points->itembytes +
+      m.tetrahedrons->maxitems * m.tetrahedrons->itembytes;
+    if (m.subfaces != (tetgenmesh::memorypool *) NULL) { // only created with -p or -r
+      out->pool_stats.subfaces_items = m.subfaces->items;
+      out->pool_stats.subfaces_max_items = m.subfaces->maxitems;
+      out->pool_stats.pool_peak_bytes +=
+        m.subfaces->maxitems * m.subfaces->itembytes;
+    }
+    if (m.subsegs != (tetgenmesh::memorypool *) NULL) {
+      out->pool_stats.subsegs_items = m.subsegs->items;
+      out->pool_stats.subsegs_max_items = m.subsegs->maxitems;
+      out->pool_stats.pool_peak_bytes +=
+        m.subsegs->maxitems * m.subsegs->itembytes;
+    }
+    out->pool_stats.work_memory_bytes = (long)m.totalworkmemory;
+  }
+  // dorival / capture the phase timings and counters for telemetry / END
+
   if (!b->quiet) {
     printf("\nOutput seconds:  %g\n", ((REAL)(tv[11] - tv[10])) / cps);
     printf("Total running seconds:  %g\n", ((REAL)(tv[11] - tv[0])) / cps);
@@ -278,6 +278,33 @@ public:
       int cell; // the global ID of "a" tetrahedron touching this face
   } marked_face_t;
   std::vector<marked_face_t> marked_faces; // dorival
+  typedef struct {
+      double delaunay_seconds; // initial Delaunay (mesh reconstruction when refining)
+      double surface_mesh_seconds; // PLC surface meshing
+      double sizing_seconds; // background mesh reconstruction and size interpolation
+      double recovery_seconds; // boundary recovery, hole carving, Delaunay recovery
+      double refinement_seconds; // quality (Delaunay) refinement
+      double optimization_seconds; // mesh optimization passes
+      double output_seconds; // writing the output arrays
+      double total_seconds;
+      long points_inserted; // output points minus input points
+      long steiner_on_segments; // Steiner points added on boundary segments
+      long steiner_on_facets; // Steiner points added on boundary facets
+      long steiner_in_volume; // Steiner points added in the interior
+      long flips; // total elementary flips (1-to-4, 2-to-3, 3-to-2, ...)
+      long duplicated_vertices;
+      long unused_vertices;
+  } mesh_stats_t;
+  mesh_stats_t stats; // dorival: filled by tetrahedralize() (output only)
+  typedef struct {
+      long points_items, points_max_items; // live and peak items of the point pool
+      long tetrahedrons_items, tetrahedrons_max_items;
+      long subfaces_items, subfaces_max_items;
+      long subsegs_items, subsegs_max_items;
+      long pool_peak_bytes; // peak heap use of the four pools (bytes)
+      long work_memory_bytes; // auxiliary working arrays (totalworkmemory)
+  } pool_stats_t;
+  pool_stats_t pool_stats; // dorival: filled by tetrahedralize() (output only)
   // dorival ///////////////////////////////////////////////////////////////////////////
 
   // 'edgelist':  An array of edge endpoints.  The first edge's endpoints
@@ -425,6 +452,9 @@ public:
     numberofvfacets = 0;
     numberofvcells = 0;
 
+    memset(&stats, 0, sizeof(stats)); // dorival
+    memset(&pool_stats, 0, sizeof(pool_stats)); // dorival
+
     tetunsuitable = NULL;
 
     geomhandle = NULL;
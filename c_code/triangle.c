@@ -642,16 +642,36 @@ struct memorypool {
 
 /* Global constants.                                                         */
 
-REAL splitter;       /* Used to split REAL factors for exact multiplication. */
-REAL epsilon;                             /* Floating-point machine epsilon. */
-REAL resulterrbound;
-REAL ccwerrboundA, ccwerrboundB, ccwerrboundC;
-REAL iccerrboundA, iccerrboundB, iccerrboundC;
-REAL o3derrboundA, o3derrboundB, o3derrboundC;
+/* dorival: for IEEE 754 arithmetic these values are derivable at compile    */
+/*   time, so they are constants now and exactinit() only verifies them.     */
+/*   This makes triangulate() reentrant: multiple meshers may run            */
+/*   concurrently from different threads.                                    */
+
+#ifdef SINGLE
+#define TRI_EPSILON 5.9604644775390625e-08                     /* = 2^(-24) */
+#define TRI_SPLITTER 4097.0                                    /* = 2^12+1  */
+#else /* not SINGLE */
+#define TRI_EPSILON 1.1102230246251565e-16                     /* = 2^(-53) */
+#define TRI_SPLITTER 134217729.0                               /* = 2^27+1  */
+#endif /* not SINGLE */
+
+static const REAL splitter = TRI_SPLITTER; /* Used to split REAL factors for exact multiplication. */
+static const REAL epsilon = TRI_EPSILON;  /* Floating-point machine epsilon. */
+static const REAL resulterrbound = (3.0 + 8.0 * TRI_EPSILON) * TRI_EPSILON;
+static const REAL ccwerrboundA = (3.0 + 16.0 * TRI_EPSILON) * TRI_EPSILON;
+static const REAL ccwerrboundB = (2.0 + 12.0 * TRI_EPSILON) * TRI_EPSILON;
+static const REAL ccwerrboundC = (9.0 + 64.0 * TRI_EPSILON) * TRI_EPSILON * TRI_EPSILON;
+static const REAL iccerrboundA = (10.0 + 96.0 * TRI_EPSILON) * TRI_EPSILON;
+static const REAL iccerrboundB = (4.0 + 48.0 * TRI_EPSILON) * TRI_EPSILON;
+static const REAL iccerrboundC = (44.0 + 576.0 * TRI_EPSILON) * TRI_EPSILON * TRI_EPSILON;
+static const REAL o3derrboundA = (7.0 + 56.0 * TRI_EPSILON) * TRI_EPSILON;
+static const REAL o3derrboundB = (3.0 + 28.0 * TRI_EPSILON) * TRI_EPSILON;
+static const REAL o3derrboundC = (26.0 + 288.0 * TRI_EPSILON) * TRI_EPSILON * TRI_EPSILON;
 
 /* Random number seed is not constant, but I've made it global anyway.       */
+/* dorival: thread-local so that concurrent triangulations do not share it.  */
 
-size_t randomseed;                     /* Current random number seed. */
+static _Thread_local size_t randomseed;        /* Current random number seed. */
 
 
 /* Mesh data structure.  Triangle operates on only one mesh, but the mesh    */
@@ -4888,6 +4908,7 @@ void exactinit()
 {
   REAL half;
   REAL check, lastcheck;
+  REAL eps, split;
   int every_other;
 #ifdef LINUX
   int cword;
@@ -4911,36 +4932,31 @@ void exactinit()
   _FPU_SETCW(cword);
 #endif /* LINUX */
 
-  every_other = 1;
-  half = 0.5;
-  epsilon = 1.0;
-  splitter = 1.0;
-  check = 1.0;
-  /* Repeatedly divide `epsilon' by two until it is too small to add to      */
+  /* Repeatedly divide `eps' by two until it is too small to add to          */
   /*   one without causing roundoff.  (Also check if the sum is equal to     */
   /*   the previous sum, for machines that round up instead of using exact   */
   /*   rounding.  Not that these routines will work on such machines.)       */
+  /* dorival: `epsilon' and `splitter' are compile-time constants now; this  */
+  /*   loop only verifies that the arithmetic really is IEEE 754.            */
+  every_other = 1;
+  half = 0.5;
+  eps = 1.0;
+  split = 1.0;
+  check = 1.0;
   do {
     lastcheck = check;
-    epsilon *= half;
+    eps *= half;
     if (every_other) {
-      splitter *= 2.0;
+      split *= 2.0;
     }
     every_other = !every_other;
-    check = 1.0 + epsilon;
+    check = 1.0 + eps;
   } while ((check != 1.0) && (check != lastcheck));
-  splitter += 1.0;
-  /* Error bounds for orientation and incircle tests. */
-  resulterrbound = (3.0 + 8.0 * epsilon) * epsilon;
-  ccwerrboundA = (3.0 + 16.0 * epsilon) * epsilon;
-  ccwerrboundB = (2.0 + 12.0 * epsilon) * epsilon;
-  ccwerrboundC = (9.0 + 64.0 * epsilon) * epsilon * epsilon;
-  iccerrboundA = (10.0 + 96.0 * epsilon) * epsilon;
-  iccerrboundB = (4.0 + 48.0 * epsilon) * epsilon;
-  iccerrboundC = (44.0 + 576.0 * epsilon) * epsilon * epsilon;
-  o3derrboundA = (7.0 + 56.0 * epsilon) * epsilon;
-  o3derrboundB = (3.0 + 28.0 * epsilon) * epsilon;
-  o3derrboundC = (26.0 + 288.0 * epsilon) * epsilon * epsilon;
+  split += 1.0;
+  if ((eps != epsilon) || (split != splitter)) {
+    printf("Error:  The floating-point arithmetic is not IEEE 754.\n");
+    triexit(1);
+  }
 }
 
 /*****************************************************************************/
@@ -16006,6 +16022,24 @@ char **argv;
   }
 #endif /* not REDUCED */
 
+#ifdef TRILIBRARY
+  /* dorival: capture the memory pool usage before the pools are freed */
+  out->poolvertices_items = (long) m.vertices.items;
+  out->poolvertices_maxitems = (long) m.vertices.maxitems;
+  out->pooltriangles_items = (long) m.triangles.items;
+  out->pooltriangles_maxitems = (long) m.triangles.maxitems;
+  out->poolsubsegs_items = (long) m.subsegs.items;
+  out->poolsubsegs_maxitems = (long) m.subsegs.maxitems;
+  out->pool_peak_bytes = (long) (m.vertices.maxitems * m.vertices.itembytes +
+                                 m.triangles.maxitems * m.triangles.itembytes +
+                                 m.subsegs.maxitems * m.subsegs.itembytes +
+                                 m.viri.maxitems * m.viri.itembytes +
+                                 m.badsubsegs.maxitems * m.badsubsegs.itembytes +
+                                 m.badtriangles.maxitems * m.badtriangles.itembytes +
+                                 m.flipstackers.maxitems * m.flipstackers.itembytes +
+                                 m.splaynodes.maxitems * m.splaynodes.itembytes);
+#endif /* TRILIBRARY */
+
   triangledeinit(&m, &b);
 #ifndef TRILIBRARY
   return 0;
@@ -277,6 +277,13 @@ struct triangulateio {
   int *edgemarkerlist;            /* Not used with Voronoi diagram; out only */
   REAL *normlist;                /* Used only with Voronoi diagram; out only */
   int numberofedges;                                             /* Out only */
+
+  /* dorival: memory pool usage captured at the end of triangulate(), just   */
+  /* before the pools are freed; `maxitems' are high-water marks.  Out only. */
+  long poolvertices_items, poolvertices_maxitems;
+  long pooltriangles_items, pooltriangles_maxitems;
+  long poolsubsegs_items, poolsubsegs_maxitems;
+  long pool_peak_bytes;  /* approximate peak heap use of all pools (bytes)   */
 };
 
 #ifdef ANSI_DECLARATORS
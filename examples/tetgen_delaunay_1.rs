@@ -17,7 +17,7 @@ fn main() -> Result<(), StrError> {
         .set_point(7, 0, 0.0, 1.0, 1.0)?;
 
     // generate Delaunay triangulation
-    tetgen.generate_delaunay(false)?;
+    tetgen.generate_delaunay(false, true)?;
 
     // draw edges of tetrahedra
     let mut plot = Plot::new();
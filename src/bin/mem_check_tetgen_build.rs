@@ -17,9 +17,68 @@ fn main() {
         handle.join().unwrap();
     }
 
+    soak().unwrap();
+
     println!("\nDone\n");
 }
 
+/// Reads the resident set size (RSS) of this process in KiB (Linux only)
+fn rss_kib() -> Option<u64> {
+    let status = std::fs::read_to_string("/proc/self/status").ok()?;
+    let line = status.lines().find(|line| line.starts_with("VmRSS:"))?;
+    line.split_whitespace().nth(1)?.parse().ok()
+}
+
+/// Runs repeated generate/drop cycles recording RSS and pool high-water marks;
+/// a steadily growing RSS with flat pool peaks indicates a leak outside the pools
+fn soak() -> Result<(), StrError> {
+    const NCYCLE: usize = 50;
+    println!("\nSoak: {} generate/drop cycles", NCYCLE);
+    println!("{:>5} {:>12} {:>16} {:>16}", "cycle", "rss_kib", "pool_peak_bytes", "work_mem_bytes");
+    let mut max_pool_peak = 0;
+    let mut max_work_memory = 0;
+    for cycle in 0..NCYCLE {
+        let mut tetgen = Tetgen::new(4, Some(vec![3, 3, 3, 3]), None, None)?;
+        tetgen
+            .set_point(0, 0, 0.0, 0.0, 0.0)?
+            .set_point(1, 0, 1.0, 0.0, 0.0)?
+            .set_point(2, 0, 0.0, 1.0, 0.0)?
+            .set_point(3, 0, 0.0, 0.0, 1.0)?;
+        tetgen
+            .set_facet_point(0, 0, 0)?
+            .set_facet_point(0, 1, 2)?
+            .set_facet_point(0, 2, 1)?;
+        tetgen
+            .set_facet_point(1, 0, 0)?
+            .set_facet_point(1, 1, 1)?
+            .set_facet_point(1, 2, 3)?;
+        tetgen
+            .set_facet_point(2, 0, 0)?
+            .set_facet_point(2, 1, 3)?
+            .set_facet_point(2, 2, 2)?;
+        tetgen
+            .set_facet_point(3, 0, 1)?
+            .set_facet_point(3, 1, 2)?
+            .set_facet_point(3, 2, 3)?;
+        tetgen.generate_mesh(false, false, Some(0.001), None)?;
+        let pools = tetgen.pool_stats();
+        max_pool_peak = max_pool_peak.max(pools.pool_peak_bytes);
+        max_work_memory = max_work_memory.max(pools.work_memory_bytes);
+        if (cycle + 1) % 10 == 0 {
+            let rss = rss_kib().unwrap_or(0);
+            println!(
+                "{:>5} {:>12} {:>16} {:>16}",
+                cycle + 1,
+                rss,
+                pools.pool_peak_bytes,
+                pools.work_memory_bytes
+            );
+        }
+    }
+    println!("high-water: pool_peak_bytes = {}, work_mem_bytes = {}", max_pool_peak, max_work_memory);
+    Ok(())
+}
+
 fn run_all() -> Result<(), StrError> {
     let _tet = Tetgen::new(4, Some(vec![3, 3, 3, 3]), Some(1), Some(1))?;
     new_captures_some_errors();
@@ -107,7 +166,7 @@ fn set_hole_captures_some_errors() -> Result<(), StrError> {
 fn generate_methods_capture_some_errors() -> Result<(), StrError> {
     let mut tetgen = Tetgen::new(4, Some(vec![3, 3, 3, 3]), None, None)?;
     assert_eq!(
-        tetgen.generate_delaunay(false).err(),
+        tetgen.generate_delaunay(false, true).err(),
         Some("cannot generate Delaunay tetrahedralization because not all points are set")
     );
     assert_eq!(
@@ -133,7 +192,7 @@ fn generate_delaunay_works() -> Result<(), StrError> {
         .set_point(1, 0, 1.0, 0.0, 0.0)?
         .set_point(2, 0, 0.0, 1.0, 0.0)?
         .set_point(3, 0, 0.0, 0.0, 1.0)?;
-    tetgen.generate_delaunay(false)?;
+    tetgen.generate_delaunay(false, true)?;
     assert_eq!(tetgen.out_ncell(), 1);
     assert_eq!(tetgen.out_npoint(), 4);
     Ok(())
@@ -26,10 +26,48 @@ fn main() {
         handle.join().unwrap();
     }
 
+    soak().unwrap();
+
     thread::sleep(Duration::from_millis(250));
     println!("Done\n");
 }
 
+/// Reads the resident set size (RSS) of this process in KiB (Linux only)
+fn rss_kib() -> Option<u64> {
+    let status = std::fs::read_to_string("/proc/self/status").ok()?;
+    let line = status.lines().find(|line| line.starts_with("VmRSS:"))?;
+    line.split_whitespace().nth(1)?.parse().ok()
+}
+
+/// Runs repeated generate/drop cycles recording RSS and pool high-water marks;
+/// a steadily growing RSS with flat pool peaks indicates a leak outside the pools
+fn soak() -> Result<(), StrError> {
+    const NCYCLE: usize = 50;
+    println!("\nSoak: {} generate/drop cycles", NCYCLE);
+    println!("{:>5} {:>12} {:>16}", "cycle", "rss_kib", "pool_peak_bytes");
+    let mut max_pool_peak = 0;
+    for cycle in 0..NCYCLE {
+        let mut trigen = Trigen::new(3, Some(3), None, None)?;
+        trigen
+            .set_point(0, 0, 0.0, 0.0)?
+            .set_point(1, 0, 1.0, 0.0)?
+            .set_point(2, 0, 0.0, 1.0)?;
+        trigen
+            .set_segment(0, 0, 0, 1)?
+            .set_segment(1, 0, 1, 2)?
+            .set_segment(2, 0, 2, 0)?;
+        trigen.generate_mesh(false, false, true, Some(0.0001), None)?;
+        let pools = trigen.pool_stats();
+        max_pool_peak = max_pool_peak.max(pools.pool_peak_bytes);
+        if (cycle + 1) % 10 == 0 {
+            let rss = rss_kib().unwrap_or(0);
+            println!("{:>5} {:>12} {:>16}", cycle + 1, rss, pools.pool_peak_bytes);
+        }
+    }
+    println!("high-water: pool_peak_bytes = {}", max_pool_peak);
+    Ok(())
+}
+
 fn new_captures_some_errors() {
     assert_eq!(Trigen::new(2, None, None, None).err(), Some("npoint must be ≥ 3"));
     assert_eq!(Trigen::new(3, Some(2), None, None).err(), Some("nsegment must be ≥ 3"));
@@ -0,0 +1,427 @@
+use std::env;
+use std::fs;
+use std::path::{Path, PathBuf};
+use std::time::Instant;
+use tritet::{StrError, Tetgen, Trigen};
+
+const USAGE: &str = "Usage: replay_mesh_jobs <jobs_dir> [ncycle]";
+
+const STAGE_NAMES: [&str; 4] = ["set", "generate", "extract", "write"];
+
+fn main() -> Result<(), StrError> {
+    let mut args = env::args().skip(1);
+    let jobs_dir = match args.next() {
+        Some(dir) => PathBuf::from(dir),
+        None => {
+            eprintln!("{}", USAGE);
+            return Err("missing jobs directory");
+        }
+    };
+    let ncycle: usize = match args.next() {
+        Some(n) => n.parse().map_err(|_| "ncycle must be a positive integer")?,
+        None => 10,
+    };
+    if ncycle < 1 {
+        return Err("ncycle must be a positive integer");
+    }
+
+    let jobs = load_jobs(&jobs_dir)?;
+    if jobs.is_empty() {
+        return Err("no .job files found in the jobs directory");
+    }
+    println!(
+        "Replaying {} job(s) from {} for {} cycle(s)\n",
+        jobs.len(),
+        jobs_dir.display(),
+        ncycle
+    );
+
+    // micros[job][stage] holds one sample per cycle
+    let mut micros: Vec<[Vec<u128>; 4]> = jobs.iter().map(|_| std::array::from_fn(|_| Vec::new())).collect();
+    let mut peak_rss_kib = rss_kib().unwrap_or(0);
+    for _ in 0..ncycle {
+        for (job, samples) in jobs.iter().zip(micros.iter_mut()) {
+            let stages = match job.kind {
+                JobKind::Pslg => replay_pslg(job)?,
+                JobKind::Plc => replay_plc(job)?,
+            };
+            for (sample, stage_micros) in stages.iter().zip(samples.iter_mut()) {
+                stage_micros.push(*sample);
+            }
+            peak_rss_kib = peak_rss_kib.max(rss_kib().unwrap_or(0));
+        }
+    }
+
+    println!(
+        "{:<24} {:<9} {:>10} {:>10} {:>10} {:>10} {:>10}",
+        "job", "stage", "min", "p50", "p90", "p99", "max"
+    );
+    for (job, samples) in jobs.iter().zip(micros.iter_mut()) {
+        for (stage, stage_micros) in STAGE_NAMES.iter().zip(samples.iter_mut()) {
+            stage_micros.sort_unstable();
+            println!(
+                "{:<24} {:<9} {:>10} {:>10} {:>10} {:>10} {:>10}",
+                if *stage == "set" { job.name.as_str() } else { "" },
+                stage,
+                stage_micros[0],
+                percentile(stage_micros, 50),
+                percentile(stage_micros, 90),
+                percentile(stage_micros, 99),
+                stage_micros[stage_micros.len() - 1],
+            );
+        }
+    }
+    println!("\nlatencies in microseconds; peak RSS = {} KiB", peak_rss_kib);
+    Ok(())
+}
+
+/// Reads the resident set size (RSS) of this process in KiB (Linux only)
+fn rss_kib() -> Option<u64> {
+    let status = fs::read_to_string("/proc/self/status").ok()?;
+    let line = status.lines().find(|line| line.starts_with("VmRSS:"))?;
+    line.split_whitespace().nth(1)?.parse().ok()
+}
+
+/// Returns the nearest-rank percentile of an ascending-sorted sample set
+fn percentile(sorted: &[u128], p: usize) -> u128 {
+    let n = sorted.len();
+    let rank = (p * n).div_ceil(100).max(1);
+    sorted[rank - 1]
+}
+
+/// Selects the generator replayed by a recorded job
+enum JobKind {
+    /// Planar Straight Line Graph: a 2D job replayed through Triangle
+    Pslg,
+    /// Piecewise Linear Complex: a 3D job replayed through TetGen
+    Plc,
+}
+
+/// A recorded mesh job: the input geometry plus the meshing options, as captured
+/// from a production run (see data/jobs/README.md for the file format)
+struct MeshJob {
+    name: String,
+    kind: JobKind,
+    coords: Vec<f64>, // 2 (PSLG) or 3 (PLC) entries per point
+    point_markers: Vec<i32>,
+    segments: Vec<i32>, // 2 entries per segment (PSLG only)
+    segment_markers: Vec<i32>,
+    facet_npoint: Vec<usize>, // PLC only
+    facet_offsets: Vec<i32>,
+    facet_vertices: Vec<i32>,
+    regions: Vec<(usize, [f64; 3], Option<f64>)>, // attribute, seed point, max size
+    holes: Vec<[f64; 3]>,
+    max_size: Option<f64>, // global max area (PSLG) or max volume (PLC)
+    min_angle: Option<f64>,
+    quadratic: bool, // six-node triangles / ten-node tetrahedra
+    no_bisect: bool, // keep the boundary intact: no new points on it (PSLG only)
+}
+
+/// Loads all .job files of the given directory, sorted by filename
+fn load_jobs(jobs_dir: &Path) -> Result<Vec<MeshJob>, StrError> {
+    let entries = fs::read_dir(jobs_dir).map_err(|_| "cannot read the jobs directory")?;
+    let mut paths: Vec<PathBuf> = entries
+        .filter_map(|entry| entry.ok())
+        .map(|entry| entry.path())
+        .filter(|path| path.extension().map(|ext| ext == "job").unwrap_or(false))
+        .collect();
+    paths.sort();
+    let mut jobs = Vec::new();
+    for path in &paths {
+        jobs.push(parse_job(path).map_err(|message| {
+            eprintln!("in job file {}: {}", path.display(), message);
+            message
+        })?);
+    }
+    Ok(jobs)
+}
+
+/// Parses one recorded job file (line-oriented; '#' starts a comment)
+fn parse_job(path: &Path) -> Result<MeshJob, StrError> {
+    let text = fs::read_to_string(path).map_err(|_| "cannot read the job file")?;
+    let name = match path.file_stem() {
+        Some(stem) => stem.to_string_lossy().into_owned(),
+        None => return Err("cannot extract the job name from the filename"),
+    };
+    let mut kind: Option<JobKind> = None;
+    let mut job = MeshJob {
+        name,
+        kind: JobKind::Pslg,
+        coords: Vec::new(),
+        point_markers: Vec::new(),
+        segments: Vec::new(),
+        segment_markers: Vec::new(),
+        facet_npoint: Vec::new(),
+        facet_offsets: vec![0],
+        facet_vertices: Vec::new(),
+        regions: Vec::new(),
+        holes: Vec::new(),
+        max_size: None,
+        min_angle: None,
+        quadratic: false,
+        no_bisect: false,
+    };
+    for line in text.lines() {
+        let line = match line.split('#').next() {
+            Some(code) => code.trim(),
+            None => "",
+        };
+        if line.is_empty() {
+            continue;
+        }
+        let mut tokens = line.split_whitespace();
+        let keyword = tokens.next().unwrap();
+        let values: Vec<&str> = tokens.collect();
+        let ndim = match kind {
+            Some(JobKind::Pslg) => 2,
+            Some(JobKind::Plc) => 3,
+            None => {
+                if keyword != "kind" {
+                    return Err("the first entry of a job file must be 'kind pslg' or 'kind plc'");
+                }
+                0
+            }
+        };
+        match keyword {
+            "kind" => {
+                kind = match values.first() {
+                    Some(&"pslg") => Some(JobKind::Pslg),
+                    Some(&"plc") => Some(JobKind::Plc),
+                    _ => return Err("kind must be 'pslg' or 'plc'"),
+                };
+            }
+            "point" => {
+                // point <x> <y> [z] [marker]
+                if values.len() < ndim || values.len() > ndim + 1 {
+                    return Err("wrong number of values in a point entry");
+                }
+                for value in &values[..ndim] {
+                    job.coords.push(parse_f64(value)?);
+                }
+                job.point_markers.push(match values.get(ndim) {
+                    Some(marker) => parse_i32(marker)?,
+                    None => 0,
+                });
+            }
+            "segment" => {
+                // segment <a> <b> [marker]
+                if ndim != 2 {
+                    return Err("segment entries are only valid in a pslg job");
+                }
+                if values.len() < 2 || values.len() > 3 {
+                    return Err("wrong number of values in a segment entry");
+                }
+                job.segments.push(parse_i32(values[0])?);
+                job.segments.push(parse_i32(values[1])?);
+                job.segment_markers.push(match values.get(2) {
+                    Some(marker) => parse_i32(marker)?,
+                    None => 0,
+                });
+            }
+            "facet" => {
+                // facet <p0> <p1> <p2> [p3 ...]
+                if ndim != 3 {
+                    return Err("facet entries are only valid in a plc job");
+                }
+                if values.len() < 3 {
+                    return Err("a facet entry needs at least three point IDs");
+                }
+                for value in &values {
+                    job.facet_vertices.push(parse_i32(value)?);
+                }
+                job.facet_npoint.push(values.len());
+                job.facet_offsets.push(job.facet_vertices.len() as i32);
+            }
+            "region" => {
+                // region <attribute> <x> <y> [z] [max_size]
+                if values.len() < 1 + ndim || values.len() > 2 + ndim {
+                    return Err("wrong number of values in a region entry");
+                }
+                let attribute = parse_i32(values[0])? as usize;
+                let mut seed = [0.0; 3];
+                for (dim, value) in values[1..1 + ndim].iter().enumerate() {
+                    seed[dim] = parse_f64(value)?;
+                }
+                let max_size = match values.get(1 + ndim) {
+                    Some(value) => Some(parse_f64(value)?),
+                    None => None,
+                };
+                job.regions.push((attribute, seed, max_size));
+            }
+            "hole" => {
+                // hole <x> <y> [z]
+                if values.len() != ndim {
+                    return Err("wrong number of values in a hole entry");
+                }
+                let mut seed = [0.0; 3];
+                for (dim, value) in values.iter().enumerate() {
+                    seed[dim] = parse_f64(value)?;
+                }
+                job.holes.push(seed);
+            }
+            "max_area" | "max_volume" => {
+                let value = values.first().ok_or("missing value in a max_area/max_volume entry")?;
+                job.max_size = Some(parse_f64(value)?);
+            }
+            "min_angle" => {
+                let value = values.first().ok_or("missing value in a min_angle entry")?;
+                job.min_angle = Some(parse_f64(value)?);
+            }
+            "quadratic" | "o2" => {
+                job.quadratic = true;
+            }
+            "no_bisect" => {
+                if ndim != 2 {
+                    return Err("no_bisect entries are only valid in a pslg job");
+                }
+                job.no_bisect = true;
+            }
+            _ => return Err("unknown keyword in the job file"),
+        }
+    }
+    job.kind = kind.ok_or("the job file has no 'kind' entry")?;
+    match job.kind {
+        JobKind::Pslg => {
+            if job.point_markers.len() < 3 || job.segment_markers.len() < 3 {
+                return Err("a pslg job needs at least three points and three segments");
+            }
+        }
+        JobKind::Plc => {
+            if job.point_markers.len() < 4 || job.facet_npoint.len() < 4 {
+                return Err("a plc job needs at least four points and four facets");
+            }
+        }
+    }
+    Ok(job)
+}
+
+fn parse_f64(value: &str) -> Result<f64, StrError> {
+    value.parse().map_err(|_| "cannot parse a floating-point value")
+}
+
+fn parse_i32(value: &str) -> Result<i32, StrError> {
+    value.parse().map_err(|_| "cannot parse an integer value")
+}
+
+/// Replays one cycle of a PSLG job through Triangle, returning the latency (µs)
+/// of the set, generate, extract, and write stages
+fn replay_pslg(job: &MeshJob) -> Result<[u128; 4], StrError> {
+    let npoint = job.point_markers.len();
+    let nsegment = job.segment_markers.len();
+
+    let start = Instant::now();
+    let mut trigen = Trigen::new(
+        npoint,
+        Some(nsegment),
+        if job.regions.is_empty() {
+            None
+        } else {
+            Some(job.regions.len())
+        },
+        if job.holes.is_empty() {
+            None
+        } else {
+            Some(job.holes.len())
+        },
+    )?;
+    trigen.set_points_batch(&job.coords, &job.point_markers)?;
+    trigen.set_segments_batch(&job.segments, &job.segment_markers)?;
+    for (index, (attribute, seed, max_area)) in job.regions.iter().enumerate() {
+        trigen.set_region(index, *attribute, seed[0], seed[1], *max_area)?;
+    }
+    for (index, seed) in job.holes.iter().enumerate() {
+        trigen.set_hole(index, seed[0], seed[1])?;
+    }
+    let set_micros = start.elapsed().as_micros();
+
+    let start = Instant::now();
+    trigen.generate_mesh(false, job.quadratic, !job.no_bisect, job.max_size, job.min_angle)?;
+    let generate_micros = start.elapsed().as_micros();
+
+    // extract through the per-entity accessors (one FFI call each), replaying the
+    // access pattern of a downstream mesh consumer
+    let start = Instant::now();
+    let mut checksum = 0.0;
+    for index in 0..trigen.out_npoint() {
+        checksum += trigen.out_point(index, 0) + trigen.out_point(index, 1);
+        checksum += trigen.out_point_marker(index) as f64;
+    }
+    let ncorner = trigen.out_cell_npoint();
+    for index in 0..trigen.out_ncell() {
+        for m in 0..ncorner {
+            checksum += trigen.out_cell_point(index, m) as f64;
+        }
+        checksum += trigen.out_cell_attribute(index) as f64;
+    }
+    std::hint::black_box(checksum);
+    let extract_micros = start.elapsed().as_micros();
+
+    let start = Instant::now();
+    let vtu_path = env::temp_dir().join(format!("replay_{}.vtu", job.name));
+    trigen.write_vtu_binary(&vtu_path)?;
+    let write_micros = start.elapsed().as_micros();
+
+    Ok([set_micros, generate_micros, extract_micros, write_micros])
+}
+
+/// Replays one cycle of a PLC job through TetGen, returning the latency (µs)
+/// of the set, generate, extract, and write stages
+fn replay_plc(job: &MeshJob) -> Result<[u128; 4], StrError> {
+    let npoint = job.point_markers.len();
+
+    let start = Instant::now();
+    let mut tetgen = Tetgen::new(
+        npoint,
+        Some(job.facet_npoint.clone()),
+        if job.regions.is_empty() {
+            None
+        } else {
+            Some(job.regions.len())
+        },
+        if job.holes.is_empty() {
+            None
+        } else {
+            Some(job.holes.len())
+        },
+    )?;
+    tetgen.set_points_batch(&job.coords, &job.point_markers)?;
+    tetgen.set_facets_batch(&job.facet_offsets, &job.facet_vertices, None)?;
+    for (index, (attribute, seed, max_volume)) in job.regions.iter().enumerate() {
+        tetgen.set_region(index, *attribute, seed[0], seed[1], seed[2], *max_volume)?;
+    }
+    for (index, seed) in job.holes.iter().enumerate() {
+        tetgen.set_hole(index, seed[0], seed[1], seed[2])?;
+    }
+    let set_micros = start.elapsed().as_micros();
+
+    let start = Instant::now();
+    tetgen.generate_mesh(false, job.quadratic, job.max_size, job.min_angle)?;
+    let generate_micros = start.elapsed().as_micros();
+
+    // extract through the per-entity accessors (one FFI call each), replaying the
+    // access pattern of a downstream mesh consumer
+    let start = Instant::now();
+    let mut checksum = 0.0;
+    for index in 0..tetgen.out_npoint() {
+        for dim in 0..3 {
+            checksum += tetgen.out_point(index, dim);
+        }
+        checksum += tetgen.out_point_marker(index) as f64;
+    }
+    let ncorner = tetgen.out_cell_npoint();
+    for index in 0..tetgen.out_ncell() {
+        for m in 0..ncorner {
+            checksum += tetgen.out_cell_point(index, m) as f64;
+        }
+        checksum += tetgen.out_cell_attribute(index) as f64;
+    }
+    std::hint::black_box(checksum);
+    let extract_micros = start.elapsed().as_micros();
+
+    let start = Instant::now();
+    let vtu_path = env::temp_dir().join(format!("replay_{}.vtu", job.name));
+    tetgen.write_vtu_binary(&vtu_path)?;
+    let write_micros = start.elapsed().as_micros();
+
+    Ok([set_micros, generate_micros, extract_micros, write_micros])
+}
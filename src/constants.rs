@@ -24,6 +24,16 @@ pub(crate) const TRITET_ERROR_INVALID_HOLE_INDEX: i32 = 9000;
 
 pub(crate) const TRITET_ERROR_TETGEN_FAIL: i32 = 10000;
 
+pub(crate) const TRITET_ERROR_INVALID_BATCH_COUNT: i32 = 11000;
+
+pub(crate) const TRITET_ERROR_NO_TRIANGULATION: i32 = 12000;
+pub(crate) const TRITET_ERROR_POINT_OUTSIDE_HULL: i32 = 13000;
+pub(crate) const TRITET_ERROR_NO_TETRAHEDRA: i32 = 14000;
+pub(crate) const TRITET_ERROR_FILE_IO: i32 = 15000;
+pub(crate) const TRITET_ERROR_INVALID_SNAPSHOT: i32 = 16000;
+pub(crate) const TRITET_ERROR_INVERTED_CELLS: i32 = 17000;
+pub(crate) const TRITET_ERROR_NO_VORONOI: i32 = 18000;
+
 pub(crate) fn handle_status(status: i32) -> Result<(), StrError> {
     if status == TRITET_SUCCESS {
         return Ok(());
@@ -87,6 +97,32 @@ pub(crate) fn handle_status(status: i32) -> Result<(), StrError> {
         return Err("TetGen failed: points are probably coplanar");
     }
 
+    if status == TRITET_ERROR_INVALID_BATCH_COUNT {
+        return Err("batch array length does not match the allocated number of entities");
+    }
+
+    if status == TRITET_ERROR_NO_TRIANGULATION {
+        return Err("there is no triangulation from a previous run");
+    }
+    if status == TRITET_ERROR_POINT_OUTSIDE_HULL {
+        return Err("cannot insert point: it lies outside the convex hull or coincides with an existing point");
+    }
+    if status == TRITET_ERROR_NO_TETRAHEDRA {
+        return Err("there is no tetrahedral mesh from a previous run");
+    }
+    if status == TRITET_ERROR_FILE_IO {
+        return Err("cannot read or write the snapshot file");
+    }
+    if status == TRITET_ERROR_INVALID_SNAPSHOT {
+        return Err("the snapshot file is invalid or corrupted");
+    }
+    if status == TRITET_ERROR_INVERTED_CELLS {
+        return Err("the moved points invert some triangles; a full retriangulation is needed");
+    }
+    if status == TRITET_ERROR_NO_VORONOI {
+        return Err("there is no Voronoi diagram to access");
+    }
+
     return Err("INTERNAL ERROR: some error occurred");
 }
 
@@ -1,14 +1,36 @@
 //! Triangle and tetrahedron mesh generators
 
+// The `large-indices` build variant (64-bit connectivity for meshes beyond 2^31 corner
+// entries) needs index-widened Triangle/TetGen sources; the vendored copies hard-code
+// `int`, so enabling the feature now would silently overflow -- fail loudly instead.
+#[cfg(feature = "large-indices")]
+compile_error!("the `large-indices` feature requires index-widened Triangle/TetGen sources (not vendored yet)");
+
 /// Defines a type alias for the error type as a static string
 pub type StrError = &'static str;
 
+/// Index type used by the C interface layer for entity counts and connectivity
+///
+/// This is `i32` today (matching the vendored Triangle/TetGen sources) and becomes
+/// `i64` under the `large-indices` build variant once index-widened sources are
+/// vendored; code handling large meshes should use this alias instead of `i32`.
+#[cfg(not(feature = "large-indices"))]
+pub type StorageIndex = i32;
+
+/// Index type used by the C interface layer for entity counts and connectivity
+#[cfg(feature = "large-indices")]
+pub type StorageIndex = i64;
+
 mod constants;
 mod conversion;
+mod mesh_batch;
+mod predicates;
 mod tetgen;
 mod tetgen_paraview;
 mod trigen;
 mod trigen_paraview;
+pub use crate::mesh_batch::*;
+pub use crate::predicates::*;
 pub use crate::tetgen::*;
 pub use crate::trigen::*;
 
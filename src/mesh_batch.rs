@@ -0,0 +1,275 @@
+use crate::{StrError, Tetgen, Trigen};
+use std::collections::VecDeque;
+use std::sync::{Arc, Mutex};
+use std::thread;
+use std::time::Instant;
+
+/// Counts the generated cells of a mesh (implemented by [Trigen] and [Tetgen])
+pub trait CellCount {
+    /// Returns the number of generated cells (triangles or tetrahedra)
+    fn cell_count(&self) -> usize;
+}
+
+impl CellCount for Trigen {
+    fn cell_count(&self) -> usize {
+        self.out_ncell()
+    }
+}
+
+impl CellCount for Tetgen {
+    fn cell_count(&self) -> usize {
+        self.out_ncell()
+    }
+}
+
+/// Holds the outcome of one meshing job
+pub struct BatchResult<T> {
+    /// The submission-order ID of the job
+    pub id: usize,
+
+    /// The index of the worker that ran the job
+    pub worker: usize,
+
+    /// The generated mesh (or the meshing error)
+    pub mesh: Result<T, StrError>,
+
+    /// The number of generated cells (zero if the job failed)
+    pub ncell: usize,
+
+    /// The wall-clock time spent on this job
+    pub seconds: f64,
+}
+
+/// Holds per-worker counters accumulated over a batch run
+#[derive(Clone, Copy, Debug, Default)]
+pub struct WorkerStats {
+    /// The number of jobs this worker completed
+    pub njob: usize,
+
+    /// The total number of cells this worker generated
+    pub ncell: usize,
+
+    /// The total wall-clock time this worker spent meshing
+    pub seconds: f64,
+}
+
+impl WorkerStats {
+    /// Returns the meshing throughput of this worker (cells per second)
+    pub fn cells_per_second(&self) -> f64 {
+        if self.seconds > 0.0 {
+            self.ncell as f64 / self.seconds
+        } else {
+            0.0
+        }
+    }
+}
+
+/// Schedules many independent meshing jobs over a pool of worker threads
+///
+/// Jobs that mesh independent parts (each its own [Trigen] or [Tetgen] instance) vary
+/// widely in cost, so splitting them statically over threads leaves cores idle. The
+/// batch keeps a single shared queue from which idle workers pull the next job, which
+/// balances the load regardless of the cost distribution; results are collected in
+/// completion order and per-worker throughput counters show the scaling.
+///
+/// The geometric predicates are reentrant (thread-local state), so the jobs may run
+/// truly concurrently; see the `instances_run_concurrently` tests.
+///
+/// # Examples
+///
+/// ```
+/// use tritet::{MeshBatch, StrError, Trigen};
+///
+/// fn main() -> Result<(), StrError> {
+///     let mut batch = MeshBatch::new();
+///     for i in 0..4 {
+///         let max_area = 0.1 / ((i + 1) as f64);
+///         batch.add(move || {
+///             let mut trigen = Trigen::new(3, Some(3), None, None)?;
+///             trigen
+///                 .set_point(0, 0, 0.0, 0.0)?
+///                 .set_point(1, 0, 1.0, 0.0)?
+///                 .set_point(2, 0, 0.0, 1.0)?;
+///             trigen
+///                 .set_segment(0, 0, 0, 1)?
+///                 .set_segment(1, 0, 1, 2)?
+///                 .set_segment(2, 0, 2, 0)?;
+///             trigen.generate_mesh(false, false, true, Some(max_area), None)?;
+///             Ok(trigen)
+///         });
+///     }
+///     let (results, stats) = batch.run(2);
+///     assert_eq!(results.len(), 4);
+///     assert_eq!(stats.iter().map(|s| s.njob).sum::<usize>(), 4);
+///     Ok(())
+/// }
+/// ```
+pub struct MeshBatch<T> {
+    jobs: Vec<Box<dyn FnOnce() -> Result<T, StrError> + Send>>,
+}
+
+impl<T: CellCount + Send + 'static> MeshBatch<T> {
+    /// Allocates a new empty batch
+    pub fn new() -> Self {
+        MeshBatch { jobs: Vec::new() }
+    }
+
+    /// Appends a meshing job and returns its submission-order ID
+    ///
+    /// The job builds, generates, and returns its own mesh instance; it runs on one of
+    /// the worker threads of [MeshBatch::run].
+    pub fn add<F>(&mut self, job: F) -> usize
+    where
+        F: FnOnce() -> Result<T, StrError> + Send + 'static,
+    {
+        self.jobs.push(Box::new(job));
+        self.jobs.len() - 1
+    }
+
+    /// Returns the number of submitted jobs
+    pub fn len(&self) -> usize {
+        self.jobs.len()
+    }
+
+    /// Returns true if no jobs have been submitted
+    pub fn is_empty(&self) -> bool {
+        self.jobs.is_empty()
+    }
+
+    /// Runs all jobs on nworker threads and collects the results in completion order
+    ///
+    /// Idle workers pull the next job from a shared queue, so a handful of expensive
+    /// parts cannot starve the rest of the pool. Returns the results (in the order the
+    /// jobs finished, not the order they were submitted -- see [BatchResult::id]) and
+    /// one [WorkerStats] entry per worker.
+    pub fn run(self, nworker: usize) -> (Vec<BatchResult<T>>, Vec<WorkerStats>) {
+        let nworker = usize::max(1, usize::min(nworker, self.jobs.len()));
+        let queue: Arc<Mutex<VecDeque<_>>> = Arc::new(Mutex::new(self.jobs.into_iter().enumerate().collect()));
+        let results = Arc::new(Mutex::new(Vec::new()));
+        let mut stats = Vec::with_capacity(nworker);
+        let mut handles = Vec::with_capacity(nworker);
+        for worker in 0..nworker {
+            let queue = Arc::clone(&queue);
+            let results = Arc::clone(&results);
+            handles.push(thread::spawn(move || {
+                let mut stat = WorkerStats::default();
+                loop {
+                    let job = queue.lock().unwrap().pop_front();
+                    let (id, job) = match job {
+                        Some(entry) => entry,
+                        None => break,
+                    };
+                    let start = Instant::now();
+                    let mesh = job();
+                    let seconds = start.elapsed().as_secs_f64();
+                    let ncell = match &mesh {
+                        Ok(mesh) => mesh.cell_count(),
+                        Err(_) => 0,
+                    };
+                    stat.njob += 1;
+                    stat.ncell += ncell;
+                    stat.seconds += seconds;
+                    results.lock().unwrap().push(BatchResult {
+                        id,
+                        worker,
+                        mesh,
+                        ncell,
+                        seconds,
+                    });
+                }
+                stat
+            }));
+        }
+        for handle in handles {
+            stats.push(handle.join().unwrap());
+        }
+        let results = Arc::try_unwrap(results).ok().unwrap().into_inner().unwrap();
+        (results, stats)
+    }
+}
+
+impl<T: CellCount + Send + 'static> Default for MeshBatch<T> {
+    fn default() -> Self {
+        MeshBatch::new()
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#[cfg(test)]
+mod tests {
+    use super::MeshBatch;
+    use crate::{StrError, Tetgen, Trigen};
+
+    #[test]
+    fn mesh_batch_runs_trigen_jobs() -> Result<(), StrError> {
+        let mut batch = MeshBatch::new();
+        for i in 0..8 {
+            // mesh cost varies with the area constraint, exercising the load balancing
+            let max_area = 0.01 / ((i + 1) as f64);
+            let id = batch.add(move || {
+                let mut trigen = Trigen::new(3, Some(3), None, None)?;
+                trigen
+                    .set_point(0, 0, 0.0, 0.0)?
+                    .set_point(1, 0, 1.0, 0.0)?
+                    .set_point(2, 0, 0.0, 1.0)?;
+                trigen
+                    .set_segment(0, 0, 0, 1)?
+                    .set_segment(1, 0, 1, 2)?
+                    .set_segment(2, 0, 2, 0)?;
+                trigen.generate_mesh(false, false, true, Some(max_area), None)?;
+                Ok(trigen)
+            });
+            assert_eq!(id, i);
+        }
+        assert_eq!(batch.len(), 8);
+        let (results, stats) = batch.run(3);
+        assert_eq!(results.len(), 8);
+        let mut ids: Vec<_> = results.iter().map(|r| r.id).collect();
+        ids.sort();
+        assert_eq!(ids, (0..8).collect::<Vec<_>>());
+        for res in &results {
+            assert!(res.worker < 3);
+            assert_eq!(res.ncell, res.mesh.as_ref().unwrap().out_ncell());
+            assert!(res.ncell > 0);
+        }
+        assert_eq!(stats.len(), 3);
+        assert_eq!(stats.iter().map(|s| s.njob).sum::<usize>(), 8);
+        let total: usize = results.iter().map(|r| r.ncell).sum();
+        assert_eq!(stats.iter().map(|s| s.ncell).sum::<usize>(), total);
+        Ok(())
+    }
+
+    #[test]
+    fn mesh_batch_keeps_errors_per_job() -> Result<(), StrError> {
+        let mut batch = MeshBatch::new();
+        batch.add(|| {
+            let mut tetgen = Tetgen::new(4, None, None, None)?;
+            tetgen
+                .set_point(0, 0, 0.0, 0.0, 0.0)?
+                .set_point(1, 0, 1.0, 0.0, 0.0)?
+                .set_point(2, 0, 0.0, 1.0, 0.0)?
+                .set_point(3, 0, 0.0, 0.0, 1.0)?;
+            tetgen.generate_delaunay(false, true)?;
+            Ok(tetgen)
+        });
+        batch.add(|| {
+            // points not set: the job fails without aborting the batch
+            let mut tetgen = Tetgen::new(4, None, None, None)?;
+            tetgen.generate_delaunay(false, true)?;
+            Ok(tetgen)
+        });
+        let (results, stats) = batch.run(2);
+        assert_eq!(results.len(), 2);
+        let ok = results.iter().find(|r| r.mesh.is_ok()).unwrap();
+        let fail = results.iter().find(|r| r.mesh.is_err()).unwrap();
+        assert_eq!(ok.ncell, 1);
+        assert_eq!(fail.ncell, 0);
+        assert_eq!(
+            fail.mesh.as_ref().err(),
+            Some(&"cannot generate Delaunay tetrahedralization because not all points are set")
+        );
+        assert_eq!(stats.iter().map(|s| s.njob).sum::<usize>(), 2);
+        Ok(())
+    }
+}
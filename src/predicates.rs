@@ -0,0 +1,201 @@
+use crate::conversion::to_i32;
+use crate::StrError;
+
+extern "C" {
+    fn tri_orient2d_batch(n: i32, pa: *const f64, pb: *const f64, pc: *const f64, result: *mut f64);
+    fn tri_incircle_batch(n: i32, pa: *const f64, pb: *const f64, pc: *const f64, pd: *const f64, result: *mut f64);
+    fn tri_orient3d_batch(n: i32, pa: *const f64, pb: *const f64, pc: *const f64, pd: *const f64, result: *mut f64);
+}
+
+/// Evaluates the robust 2D orientation predicate for many point triples at once
+///
+/// Each test i reads the points `(pa[2*i], pa[2*i+1])`, `(pb[..])`, and `(pc[..])` and
+/// writes into `results[i]` a positive value if the points occur in counterclockwise
+/// order, a negative value if they occur in clockwise order, and zero if they are
+/// collinear. The floating-point filter runs as a flat loop over all tests (which the
+/// compiler can vectorize), and only the tests whose error bound fails take the exact
+/// arithmetic path, so the result sign is always correct.
+///
+/// # Input
+///
+/// * `pa`, `pb`, `pc` -- packed coordinates (x, y); two entries per test
+/// * `results` -- receives the signed determinants; one entry per test
+pub fn orient2d_batch(pa: &[f64], pb: &[f64], pc: &[f64], results: &mut [f64]) -> Result<(), StrError> {
+    let n = results.len();
+    if pa.len() != 2 * n || pb.len() != 2 * n || pc.len() != 2 * n {
+        return Err("the point arrays must hold two coordinates per results entry");
+    }
+    if n == 0 {
+        return Ok(());
+    }
+    unsafe {
+        tri_orient2d_batch(to_i32(n), pa.as_ptr(), pb.as_ptr(), pc.as_ptr(), results.as_mut_ptr());
+    }
+    Ok(())
+}
+
+/// Evaluates the robust in-circle predicate for many point quadruples at once
+///
+/// Each test i writes into `results[i]` a positive value if point `pd` lies inside the
+/// circle passing through `pa`, `pb`, and `pc` (given in counterclockwise order), a
+/// negative value if it lies outside, and zero if the four points are cocircular. The
+/// floating-point filter runs as a flat loop over all tests, and only the tests whose
+/// error bound fails take the exact arithmetic path, so the result sign is always
+/// correct.
+///
+/// # Input
+///
+/// * `pa`, `pb`, `pc`, `pd` -- packed coordinates (x, y); two entries per test
+/// * `results` -- receives the signed determinants; one entry per test
+pub fn incircle_batch(pa: &[f64], pb: &[f64], pc: &[f64], pd: &[f64], results: &mut [f64]) -> Result<(), StrError> {
+    let n = results.len();
+    if pa.len() != 2 * n || pb.len() != 2 * n || pc.len() != 2 * n || pd.len() != 2 * n {
+        return Err("the point arrays must hold two coordinates per results entry");
+    }
+    if n == 0 {
+        return Ok(());
+    }
+    unsafe {
+        tri_incircle_batch(
+            to_i32(n),
+            pa.as_ptr(),
+            pb.as_ptr(),
+            pc.as_ptr(),
+            pd.as_ptr(),
+            results.as_mut_ptr(),
+        );
+    }
+    Ok(())
+}
+
+/// Evaluates the robust 3D orientation predicate for many point quadruples at once
+///
+/// Each test i writes into `results[i]` a positive value if point `pd` lies below the
+/// plane passing through `pa`, `pb`, and `pc` ("below" such that the three points appear
+/// in counterclockwise order when viewed from above), a negative value if it lies above,
+/// and zero if the four points are coplanar. The floating-point filter runs as a flat
+/// loop over all tests, and only the tests whose error bound fails take the exact
+/// arithmetic path, so the result sign is always correct.
+///
+/// # Input
+///
+/// * `pa`, `pb`, `pc`, `pd` -- packed coordinates (x, y, z); three entries per test
+/// * `results` -- receives the signed determinants; one entry per test
+pub fn orient3d_batch(pa: &[f64], pb: &[f64], pc: &[f64], pd: &[f64], results: &mut [f64]) -> Result<(), StrError> {
+    let n = results.len();
+    if pa.len() != 3 * n || pb.len() != 3 * n || pc.len() != 3 * n || pd.len() != 3 * n {
+        return Err("the point arrays must hold three coordinates per results entry");
+    }
+    if n == 0 {
+        return Ok(());
+    }
+    unsafe {
+        tri_orient3d_batch(
+            to_i32(n),
+            pa.as_ptr(),
+            pb.as_ptr(),
+            pc.as_ptr(),
+            pd.as_ptr(),
+            results.as_mut_ptr(),
+        );
+    }
+    Ok(())
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#[cfg(test)]
+mod tests {
+    use super::{incircle_batch, orient2d_batch, orient3d_batch};
+    use crate::StrError;
+
+    #[test]
+    fn orient2d_batch_works() -> Result<(), StrError> {
+        // one counterclockwise, one clockwise, one collinear, and one nearly-collinear
+        // triple whose filter fails (the sign must still come out exact)
+        let eps = f64::EPSILON;
+        #[rustfmt::skip]
+        let pa = [
+            0.0, 0.0,
+            0.0, 0.0,
+            0.0, 0.0,
+            0.5, 0.5 + eps,
+        ];
+        #[rustfmt::skip]
+        let pb = [
+            1.0, 0.0,
+            0.0, 1.0,
+            1.0, 1.0,
+            12.0, 12.0,
+        ];
+        #[rustfmt::skip]
+        let pc = [
+            0.0, 1.0,
+            1.0, 0.0,
+            2.0, 2.0,
+            24.0, 24.0,
+        ];
+        let mut results = [0.0; 4];
+        orient2d_batch(&pa, &pb, &pc, &mut results)?;
+        assert!(results[0] > 0.0);
+        assert!(results[1] < 0.0);
+        assert_eq!(results[2], 0.0);
+        assert!(results[3] > 0.0); // pa is slightly above the line through pb and pc
+        assert_eq!(
+            orient2d_batch(&pa, &pb, &pc[..6], &mut results).err(),
+            Some("the point arrays must hold two coordinates per results entry")
+        );
+        Ok(())
+    }
+
+    #[test]
+    fn incircle_batch_works() -> Result<(), StrError> {
+        // unit circle through (1,0), (0,1), (-1,0): inside, outside, and cocircular
+        let pa = [1.0, 0.0, 1.0, 0.0, 1.0, 0.0];
+        let pb = [0.0, 1.0, 0.0, 1.0, 0.0, 1.0];
+        let pc = [-1.0, 0.0, -1.0, 0.0, -1.0, 0.0];
+        let pd = [0.1, 0.1, 2.0, 2.0, 0.0, -1.0];
+        let mut results = [0.0; 3];
+        incircle_batch(&pa, &pb, &pc, &pd, &mut results)?;
+        assert!(results[0] > 0.0);
+        assert!(results[1] < 0.0);
+        assert_eq!(results[2], 0.0);
+        Ok(())
+    }
+
+    #[test]
+    fn orient3d_batch_works() -> Result<(), StrError> {
+        // plane z = 0 through (0,0,0), (1,0,0), (0,1,0): below, above, and coplanar
+        let pa = [0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0];
+        let pb = [1.0, 0.0, 0.0, 1.0, 0.0, 0.0, 1.0, 0.0, 0.0];
+        let pc = [0.0, 1.0, 0.0, 0.0, 1.0, 0.0, 0.0, 1.0, 0.0];
+        let pd = [0.2, 0.2, -1.0, 0.2, 0.2, 1.0, 0.5, 0.5, 0.0];
+        let mut results = [0.0; 3];
+        orient3d_batch(&pa, &pb, &pc, &pd, &mut results)?;
+        assert!(results[0] > 0.0);
+        assert!(results[1] < 0.0);
+        assert_eq!(results[2], 0.0);
+        Ok(())
+    }
+
+    #[test]
+    fn batches_larger_than_one_block_work() -> Result<(), StrError> {
+        // 150 tests span three blocks of the C kernel; all counterclockwise
+        let n = 150;
+        let mut pa = Vec::new();
+        let mut pb = Vec::new();
+        let mut pc = Vec::new();
+        for i in 0..n {
+            let shift = i as f64;
+            pa.extend_from_slice(&[shift, 0.0]);
+            pb.extend_from_slice(&[shift + 1.0, 0.0]);
+            pc.extend_from_slice(&[shift, 1.0]);
+        }
+        let mut results = vec![0.0; n];
+        orient2d_batch(&pa, &pb, &pc, &mut results)?;
+        for det in &results {
+            assert_eq!(*det, 1.0);
+        }
+        Ok(())
+    }
+}
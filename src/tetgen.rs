@@ -10,10 +10,34 @@ pub(crate) struct ExtTetgen {
     marker: core::marker::PhantomData<(*mut u8, core::marker::PhantomPinned)>,
 }
 
+#[repr(C)]
+struct ExtTetOptions {
+    max_volume: f64,
+    min_dihedral: f64,
+    radius_edge_ratio: f64,
+    coplanar_tol: f64,
+    verbose: i32,
+    o2: i32,
+    max_steiner: i32,
+    opt_level: i32,
+    opt_scheme: i32,
+    no_merge: i32,
+    no_exact: i32,
+    no_bisect: i32,
+}
+
 extern "C" {
     fn tet_new_tetgen(npoint: i32, nfacet: i32, facet_npoint: *const i32, nregion: i32, nhole: i32) -> *mut ExtTetgen;
     fn tet_drop_tetgen(tetgen: *mut ExtTetgen);
     fn tet_set_point(tetgen: *mut ExtTetgen, index: i32, marker: i32, x: f64, y: f64, z: f64) -> i32;
+    fn tet_set_points_batch(tetgen: *mut ExtTetgen, npoint: i32, coords: *const f64, markers: *const i32) -> i32;
+    fn tet_set_facets_batch(
+        tetgen: *mut ExtTetgen,
+        nfacet: i32,
+        offsets: *const i32,
+        vertices: *const i32,
+        markers: *const i32,
+    ) -> i32;
     fn tet_set_facet_point(tetgen: *mut ExtTetgen, index: i32, m: i32, p: i32) -> i32;
     fn tet_set_facet_marker(tetgen: *mut ExtTetgen, index: i32, marker: i32) -> i32;
     fn tet_set_region(
@@ -26,7 +50,8 @@ extern "C" {
         max_volume: f64,
     ) -> i32;
     fn tet_set_hole(tetgen: *mut ExtTetgen, index: i32, x: f64, y: f64, z: f64) -> i32;
-    fn tet_run_delaunay(tetgen: *mut ExtTetgen, verbose: i32) -> i32;
+    fn tet_run_delaunay(tetgen: *mut ExtTetgen, verbose: i32, no_exact: i32) -> i32;
+    fn tet_run_hull(tetgen: *mut ExtTetgen, verbose: i32, no_exact: i32) -> i32;
     fn tet_run_tetrahedralize(
         tetgen: *mut ExtTetgen,
         verbose: i32,
@@ -34,6 +59,20 @@ extern "C" {
         global_max_volume: f64,
         global_min_angle: f64,
     ) -> i32;
+    fn tet_run_tetrahedralize_options(tetgen: *mut ExtTetgen, options: *const ExtTetOptions) -> i32;
+    fn tet_run_refine(
+        tetgen: *mut ExtTetgen,
+        verbose: i32,
+        ncell: i32,
+        per_cell_max_volume: *const f64,
+        radius_edge_ratio: f64,
+    ) -> i32;
+    fn tet_run_tetrahedralize_bgm(
+        tetgen: *mut ExtTetgen,
+        options: *const ExtTetOptions,
+        npoint: i32,
+        point_sizes: *const f64,
+    ) -> i32;
     fn tet_out_npoint(tetgen: *mut ExtTetgen) -> i32;
     fn tet_out_ncell(tetgen: *mut ExtTetgen) -> i32;
     fn tet_out_cell_npoint(tetgen: *mut ExtTetgen) -> i32;
@@ -41,6 +80,20 @@ extern "C" {
     fn tet_out_point_marker(tetgen: *mut ExtTetgen, index: i32) -> i32;
     fn tet_out_cell_point(tetgen: *mut ExtTetgen, index: i32, corner: i32) -> i32;
     fn tet_out_cell_attribute(tetgen: *mut ExtTetgen, index: i32) -> i32;
+    fn tet_out_cell_neighbor(tetgen: *mut ExtTetgen, index: i32, side: i32) -> i32;
+    fn tet_out_neighbor_list(tetgen: *mut ExtTetgen) -> *const i32;
+    fn tet_out_visit_cells(
+        tetgen: *mut ExtTetgen,
+        visitor: unsafe extern "C" fn(
+            context: *mut std::os::raw::c_void,
+            start: i32,
+            count: i32,
+            cells: *const i32,
+            points: *const f64,
+        ) -> i32,
+        context: *mut std::os::raw::c_void,
+        chunk_size: i32,
+    ) -> i32;
     fn tet_out_n_marked_face(tetgen: *mut ExtTetgen) -> i32;
     fn tet_out_marked_face(
         tetgen: *mut ExtTetgen,
@@ -49,6 +102,136 @@ extern "C" {
         marker: *mut i32,
         cell: *mut i32,
     );
+    fn tet_out_marked_faces(
+        tetgen: *mut ExtTetgen,
+        points: *mut *const i32,
+        markers: *mut *const i32,
+        cells: *mut *const i32,
+    );
+    fn tet_adopt_output_as_input(tetgen: *mut ExtTetgen) -> i32;
+    fn tet_set_output_mesh(
+        tetgen: *mut ExtTetgen,
+        npoint: i32,
+        coords: *const f64,
+        point_markers: *const i32,
+        ncell: i32,
+        tetrahedra: *const i32,
+        attributes: *const i32,
+    ) -> i32;
+    fn tet_out_quality_histogram(
+        tetgen: *mut ExtTetgen,
+        nbin: i32,
+        histogram: *mut i64,
+        min_quality: *mut f64,
+        max_quality: *mut f64,
+    ) -> i32;
+    fn tet_out_worst_cells(
+        tetgen: *mut ExtTetgen,
+        nworst: i32,
+        cells: *mut i32,
+        qualities: *mut f64,
+        count: *mut i32,
+    ) -> i32;
+    fn tet_write_snapshot(tetgen: *mut ExtTetgen, filename: *const std::os::raw::c_char, f32_coords: i32) -> i32;
+    fn tet_read_snapshot(tetgen: *mut ExtTetgen, filename: *const std::os::raw::c_char) -> i32;
+    fn tet_out_stats(tetgen: *mut ExtTetgen, stats: *mut TetStats);
+    fn tet_out_pool_stats(tetgen: *mut ExtTetgen, stats: *mut TetPoolStats);
+}
+
+/// Holds memory pool usage captured by the last run
+///
+/// TetGen's memory pools manage all element storage; this struct exposes their live
+/// item counts and high-water marks, so container memory limits can be sized from the
+/// observed peaks instead of trial and error. All fields are zero before the first run.
+/// See [Tetgen::pool_stats].
+#[repr(C)]
+#[derive(Clone, Copy, Debug, Default, PartialEq)]
+pub struct TetPoolStats {
+    /// Number of live items of the point pool at the end of the run
+    pub points_items: i64,
+
+    /// High-water mark of the point pool
+    pub points_max_items: i64,
+
+    /// Number of live items of the tetrahedron pool
+    pub tetrahedrons_items: i64,
+
+    /// High-water mark of the tetrahedron pool
+    pub tetrahedrons_max_items: i64,
+
+    /// Number of live items of the subface pool
+    pub subfaces_items: i64,
+
+    /// High-water mark of the subface pool
+    pub subfaces_max_items: i64,
+
+    /// Number of live items of the subsegment pool
+    pub subsegs_items: i64,
+
+    /// High-water mark of the subsegment pool
+    pub subsegs_max_items: i64,
+
+    /// Peak heap use of the four pools (bytes)
+    pub pool_peak_bytes: i64,
+
+    /// Bytes of auxiliary working arrays
+    pub work_memory_bytes: i64,
+}
+
+/// Holds phase timings and counters captured by the last run
+///
+/// TetGen measures its phases internally but only prints them in verbose mode; this
+/// struct exposes the same information programmatically, so meshing latency can be
+/// attributed to Delaunay construction, boundary recovery, or quality refinement
+/// without parsing stdout. All fields are zero before the first run. See
+/// [Tetgen::stats].
+#[repr(C)]
+#[derive(Clone, Copy, Debug, Default, PartialEq)]
+pub struct TetStats {
+    /// Time of the initial Delaunay triangulation (mesh reconstruction when refining)
+    pub delaunay_seconds: f64,
+
+    /// Time of the PLC surface meshing
+    pub surface_mesh_seconds: f64,
+
+    /// Time of the background mesh reconstruction and size interpolation
+    pub sizing_seconds: f64,
+
+    /// Time of the boundary recovery, hole carving, and Delaunay recovery
+    pub recovery_seconds: f64,
+
+    /// Time of the quality (Delaunay) refinement
+    pub refinement_seconds: f64,
+
+    /// Time of the mesh optimization passes
+    pub optimization_seconds: f64,
+
+    /// Time spent writing the output arrays
+    pub output_seconds: f64,
+
+    /// Total running time of the last run
+    pub total_seconds: f64,
+
+    /// Number of output points minus the number of input points
+    pub points_inserted: i64,
+
+    /// Number of Steiner points added on boundary segments
+    pub steiner_on_segments: i64,
+
+    /// Number of Steiner points added on boundary facets
+    pub steiner_on_facets: i64,
+
+    /// Number of Steiner points added in the interior
+    pub steiner_in_volume: i64,
+
+    /// Total number of elementary flips (1-to-4, 2-to-3, 3-to-2, ...)
+    pub flips: i64,
+
+    /// Number of duplicated input vertices
+    pub duplicated_vertices: i64,
+
+    /// Number of unused input vertices
+    pub unused_vertices: i64,
 }
 
 /// Implements high-level functions to call Si's Tetgen Cpp-Code
@@ -78,7 +261,7 @@ extern "C" {
 ///         .set_point(4, 0, 1.0 / 3.0, 2.0 / 3.0, 1.0 / 3.0)?;
 ///
 ///     // generate Delaunay triangulation
-///     tetgen.generate_delaunay(false)?;
+///     tetgen.generate_delaunay(false, true)?;
 ///
 ///     // draw edges of tetrahedra
 ///     if SAVE_FIGURE{
@@ -171,6 +354,97 @@ pub struct Tetgen {
     all_holes_set: bool,              // indicates that all holes have been set
 }
 
+/// Holds options for [Tetgen::generate_mesh_with]
+///
+/// The default value (`None` or `false`) of each option selects TetGen's own default.
+/// These options cover the quality and termination levers that the command-string
+/// based [Tetgen::generate_mesh] cannot express.
+#[derive(Clone, Debug, Default)]
+pub struct TetOptions {
+    /// Prints TetGen's messages to the console
+    pub verbose: bool,
+
+    /// Generates the middle nodes; e.g., nnode = 10 (quadratic tetrahedra)
+    pub o2: bool,
+
+    /// The maximum volume constraint for all generated tetrahedra (TetGen's 'a' switch)
+    pub global_max_volume: Option<f64>,
+
+    /// The minimum dihedral angle constraint in degrees (TetGen's 'q//' option)
+    pub min_dihedral_angle: Option<f64>,
+
+    /// The maximum radius-edge ratio constraint (the first number of TetGen's 'q' switch)
+    pub radius_edge_ratio: Option<f64>,
+
+    /// The maximum number of Steiner points that TetGen may add (TetGen's 'S' switch)
+    ///
+    /// Use this to bound the refinement cost on pathological inputs; `Some(0)` forbids
+    /// Steiner points altogether.
+    pub max_steiner_points: Option<usize>,
+
+    /// The mesh optimization level from 0 (none) to 10 (TetGen's 'O' switch; default is 2)
+    pub optimization_level: Option<usize>,
+
+    /// The mesh optimization scheme bitmask: 1 = flips, 2 = smoothing, 4 = vertex
+    /// insertion/deletion (TetGen's 'O/' option; default is 7)
+    pub optimization_scheme: Option<usize>,
+
+    /// The tolerance for the coplanarity test (TetGen's 'T' switch; default is 1e-8)
+    pub coplanar_tolerance: Option<f64>,
+
+    /// Disables the merging of coplanar facets and very close vertices (TetGen's 'M' switch)
+    pub no_merge: bool,
+
+    /// Suppresses the adaptive exact arithmetic predicates (TetGen's 'X' switch)
+    ///
+    /// The inexact fast path is adequate for well-separated point sets; with degenerate
+    /// (nearly coplanar or cospherical) points, the run may then fail with
+    /// `Err("TetGen failed: ...")` or produce an invalid mesh -- fall back to exact
+    /// arithmetic in that case.
+    pub no_exact: bool,
+
+    /// Keeps the boundary facets and segments intact (TetGen's 'Y' switch)
+    ///
+    /// No Steiner points are inserted on the boundary; only the interior is refined.
+    /// This preserves the exact boundary discretization, e.g., to match a neighboring
+    /// mesh, at the price of lower element quality near the boundary.
+    pub no_bisect: bool,
+}
+
+impl TetOptions {
+    /// Maps the options to the C structure expected by the interface
+    fn to_ext(&self) -> ExtTetOptions {
+        ExtTetOptions {
+            max_volume: self.global_max_volume.unwrap_or(0.0),
+            min_dihedral: self.min_dihedral_angle.unwrap_or(0.0),
+            radius_edge_ratio: self.radius_edge_ratio.unwrap_or(0.0),
+            coplanar_tol: self.coplanar_tolerance.unwrap_or(0.0),
+            verbose: if self.verbose { 1 } else { 0 },
+            o2: if self.o2 { 1 } else { 0 },
+            max_steiner: match self.max_steiner_points {
+                Some(v) => to_i32(v),
+                None => -1,
+            },
+            opt_level: match self.optimization_level {
+                Some(v) => to_i32(v),
+                None => -1,
+            },
+            opt_scheme: match self.optimization_scheme {
+                Some(v) => to_i32(v),
+                None => -1,
+            },
+            no_merge: if self.no_merge { 1 } else { 0 },
+            no_exact: if self.no_exact { 1 } else { 0 },
+            no_bisect: if self.no_bisect { 1 } else { 0 },
+        }
+    }
+}
+
+// SAFETY: the c-code keeps all of its state in ExtTetgen (owned exclusively by this
+// struct) and in thread-local or constant globals, thus instances may be moved to
+// (and run from) other threads
+unsafe impl Send for Tetgen {}
+
 impl Drop for Tetgen {
     /// Tells the c-code to release memory
     fn drop(&mut self) {
@@ -260,6 +534,85 @@ impl Tetgen {
         Ok(self)
     }
 
+    /// Sets all point coordinates and markers at once
+    ///
+    /// This function hands the whole arrays across the FFI boundary in a single call;
+    /// thus, it is much faster than calling [Tetgen::set_point] in a loop when loading
+    /// large point clouds.
+    ///
+    /// # Input
+    ///
+    /// * `coords` -- (len = 3 × `npoint`) the coordinates organized as `[x0, y0, z0, x1, y1, z1, ...]`
+    /// * `markers` -- (len = `npoint`) the markers of the points (see [Tetgen::set_point])
+    pub fn set_points_batch(&mut self, coords: &[f64], markers: &[i32]) -> Result<&mut Self, StrError> {
+        if coords.len() != self.npoint * 3 {
+            return Err("coords.len() must be equal to 3 · npoint");
+        }
+        if markers.len() != self.npoint {
+            return Err("markers.len() must be equal to npoint");
+        }
+        unsafe {
+            let status = tet_set_points_batch(self.ext_tetgen, to_i32(self.npoint), coords.as_ptr(), markers.as_ptr());
+            handle_status(status)?;
+        }
+        self.all_points_set = true;
+        Ok(self)
+    }
+
+    /// Sets all facet point IDs (and, optionally, all facet markers) at once
+    ///
+    /// The facets are given in CSR (compressed) form: the point IDs of facet `i` are
+    /// `vertices[offsets[i] .. offsets[i+1]]`. The facet sizes implied by `offsets` must
+    /// match the `facet_npoint` array passed down to [Tetgen::new]. The whole arrays are
+    /// handed across the FFI boundary in a single call and validated in a single loop on
+    /// the C++ side; thus, this function is much faster than calling
+    /// [Tetgen::set_facet_point] in a loop for large CAD shells.
+    ///
+    /// # Input
+    ///
+    /// * `offsets` -- (len = `nfacet` + 1) the offsets into `vertices`; `offsets[0]` must be 0
+    /// * `vertices` -- (len = `offsets[nfacet]`) the point IDs of all facets, back-to-back
+    /// * `markers` -- (len = `nfacet`; optional) the markers of the facets (see [Tetgen::set_facet_marker])
+    pub fn set_facets_batch(
+        &mut self,
+        offsets: &[i32],
+        vertices: &[i32],
+        markers: Option<&[i32]>,
+    ) -> Result<&mut Self, StrError> {
+        let nfacet = match &self.facet_npoint {
+            Some(n) => n.len(),
+            None => return Err("cannot set facet point because facet_npoint is None"),
+        };
+        if offsets.len() != nfacet + 1 {
+            return Err("offsets.len() must be equal to nfacet + 1");
+        }
+        if offsets[0] != 0 || vertices.len() != offsets[nfacet] as usize {
+            return Err("offsets must start at 0 and end at vertices.len()");
+        }
+        let markers_ptr = match markers {
+            Some(m) => {
+                if m.len() != nfacet {
+                    return Err("markers.len() must be equal to nfacet");
+                }
+                m.as_ptr()
+            }
+            None => std::ptr::null(),
+        };
+        unsafe {
+            let status = tet_set_facets_batch(
+                self.ext_tetgen,
+                to_i32(nfacet),
+                offsets.as_ptr(),
+                vertices.as_ptr(),
+                markers_ptr,
+            );
+            handle_status(status)?;
+        }
+        self.facet_point_set_count = self.total_facet_npoint;
+        self.all_facets_set = true;
+        Ok(self)
+    }
+
     /// Sets the facet's point IDs
     ///
     /// # Input
@@ -378,15 +731,48 @@ impl Tetgen {
 
     /// Generates a Delaunay triangulation
     ///
+    /// This method may be called repeatedly (e.g., after updating the coordinates with
+    /// [Tetgen::set_points_batch]); the output of a previous run is released first.
+    ///
+    /// # Input
+    ///
+    /// * `verbose` -- Prints Tetgen's messages to the console
+    /// * `exact` -- Uses the adaptive exact arithmetic predicates (recommended).
+    ///   Passing `false` selects TetGen's inexact fast path ('X' switch), which is
+    ///   adequate for well-separated point sets; with degenerate (nearly coplanar or
+    ///   cospherical) points, the run may then fail with `Err("TetGen failed: ...")`
+    ///   or produce an invalid triangulation -- fall back to `exact = true` in that case
+    pub fn generate_delaunay(&mut self, verbose: bool, exact: bool) -> Result<(), StrError> {
+        if !self.all_points_set {
+            return Err("cannot generate Delaunay tetrahedralization because not all points are set");
+        }
+        unsafe {
+            let status = tet_run_delaunay(self.ext_tetgen, if verbose { 1 } else { 0 }, if exact { 0 } else { 1 });
+            handle_status(status)?;
+        }
+        Ok(())
+    }
+
+    /// Generates a Delaunay tetrahedralization retaining the convex hull
+    ///
+    /// This works like [Tetgen::generate_delaunay] but runs with TetGen's 'c' switch
+    /// (`tetgenbehavior::convex`): no facets are needed or recovered, so a hull query
+    /// pays only for the Delaunay construction. The hull triangles (with
+    /// outward-pointing normals) are published as marked faces; read them in bulk with
+    /// [Tetgen::out_marked_faces] or one by one with [Tetgen::out_marked_face]. Their
+    /// marker is 1 and their cell index is -1 (the adjacent tetrahedron is not tracked).
+    ///
     /// # Input
     ///
     /// * `verbose` -- Prints Tetgen's messages to the console
-    pub fn generate_delaunay(&self, verbose: bool) -> Result<(), StrError> {
+    /// * `exact` -- Uses the adaptive exact arithmetic predicates (recommended);
+    ///   see the notes in [Tetgen::generate_delaunay]
+    pub fn generate_hull(&mut self, verbose: bool, exact: bool) -> Result<(), StrError> {
         if !self.all_points_set {
             return Err("cannot generate Delaunay tetrahedralization because not all points are set");
         }
         unsafe {
-            let status = tet_run_delaunay(self.ext_tetgen, if verbose { 1 } else { 0 });
+            let status = tet_run_hull(self.ext_tetgen, if verbose { 1 } else { 0 }, if exact { 0 } else { 1 });
             handle_status(status)?;
         }
         Ok(())
@@ -394,6 +780,9 @@ impl Tetgen {
 
     /// Generates a conforming constrained Delaunay triangulation with some quality constraints
     ///
+    /// This method may be called repeatedly (e.g., with different constraints); the output
+    /// of a previous run is released first.
+    ///
     /// # Input
     ///
     /// * `verbose` -- Prints Tetgen's messages to the console
@@ -403,7 +792,7 @@ impl Tetgen {
     ///
     /// **Note:** TetGen automatically assigns the marker 1 for points on the boundary.
     pub fn generate_mesh(
-        &self,
+        &mut self,
         verbose: bool,
         o2: bool,
         global_max_volume: Option<f64>,
@@ -436,6 +825,402 @@ impl Tetgen {
         Ok(())
     }
 
+    /// Generates a conforming constrained Delaunay triangulation with structured options
+    ///
+    /// This works like [Tetgen::generate_mesh] but accepts a [TetOptions] with the levers
+    /// that the switch string cannot express (Steiner point cap, optimization level,
+    /// coplanar tolerance, no-merge, inexact arithmetic), useful to bound the refinement
+    /// cost on pathological CAD inputs. The options are applied to TetGen's behavior
+    /// structure directly.
+    ///
+    /// **Note:** TetGen automatically assigns the marker 1 for points on the boundary.
+    pub fn generate_mesh_with(&mut self, options: &TetOptions) -> Result<(), StrError> {
+        if !self.all_points_set {
+            return Err("cannot generate mesh of tetrahedra because not all points are set");
+        }
+        if !self.all_facets_set {
+            return Err("cannot generate mesh of tetrahedra because not all facets are set");
+        }
+        let ext_options = options.to_ext();
+        unsafe {
+            let status = tet_run_tetrahedralize_options(self.ext_tetgen, &ext_options);
+            handle_status(status)?;
+        }
+        Ok(())
+    }
+
+    /// Generates a conforming constrained Delaunay tetrahedralization using several threads
+    ///
+    /// The PLC is first meshed without a volume constraint. The resulting coarse
+    /// tetrahedra are then refined concurrently (one sub-mesh per coarse cell, distributed
+    /// over `nthread` workers) and stitched back into a single conforming mesh. The
+    /// sub-meshes conform to each other because the coarse faces are triangulated
+    /// deterministically beforehand (a uniform grid, identical from both sides) and the
+    /// workers are prohibited from inserting points on their boundary faces ('Y' switch).
+    ///
+    /// # Input
+    ///
+    /// * `verbose` -- Prints TetGen's messages to the console (coarse pass only)
+    /// * `global_max_volume` -- The maximum volume constraint for all generated tetrahedra
+    /// * `nthread` -- The number of worker threads (must be ≥ 1)
+    ///
+    /// # Warning
+    ///
+    /// Only linear tetrahedra are generated and each refined tetrahedron inherits the
+    /// regional attribute of its coarse cell. Because the coarse boundary faces are kept
+    /// intact, the element quality near them is lower than in a serial run; neighbors and
+    /// marked faces are not produced.
+    pub fn generate_mesh_parallel(
+        &mut self,
+        verbose: bool,
+        global_max_volume: Option<f64>,
+        nthread: usize,
+    ) -> Result<(), StrError> {
+        if nthread < 1 {
+            return Err("nthread must be at least 1");
+        }
+
+        // coarse pass (this also handles the case without a volume constraint)
+        self.generate_mesh(verbose, false, None, None)?;
+        let max_volume = match global_max_volume {
+            Some(v) => v,
+            None => return Ok(()),
+        };
+        if max_volume <= 0.0 {
+            return Err("global_max_volume must be positive");
+        }
+
+        // snapshot the coarse mesh
+        let ncoarse = self.out_ncell();
+        let ncoarse_point = self.out_npoint();
+        let mut points = Vec::with_capacity(ncoarse_point * 3);
+        for index in 0..ncoarse_point {
+            for dim in 0..3 {
+                points.push(self.out_point(index, dim));
+            }
+        }
+        let mut markers: Vec<i32> = (0..ncoarse_point).map(|i| self.out_point_marker(i)).collect();
+        let mut coarse_tets = Vec::with_capacity(ncoarse * 4);
+        self.out_visit_cells(16 * 1024, |_, chunk| {
+            coarse_tets.extend_from_slice(chunk);
+            true
+        })?;
+        let coarse_attributes: Vec<i32> = (0..ncoarse).map(|t| self.out_cell_attribute(t) as i32).collect();
+
+        // subdivide the coarse faces deterministically (shared between neighboring
+        // tetrahedra) with a uniform grid: every edge is split into ndiv parts, using
+        // the edge length of the regular tetrahedron with the target volume. Without
+        // this pre-subdivision, the Y switch would reject nearly every interior
+        // insertion as encroaching on the (coarse) boundary faces
+        let target_length = f64::cbrt(6.0 * f64::sqrt(2.0) * max_volume);
+        let mut max_edge_length: f64 = 0.0;
+        for t in 0..ncoarse {
+            for k in 0..4 {
+                for l in (k + 1)..4 {
+                    let (a, b) = (coarse_tets[t * 4 + k] as usize, coarse_tets[t * 4 + l] as usize);
+                    let mut length = 0.0;
+                    for dim in 0..3 {
+                        let delta = points[b * 3 + dim] - points[a * 3 + dim];
+                        length += delta * delta;
+                    }
+                    max_edge_length = f64::max(max_edge_length, f64::sqrt(length));
+                }
+            }
+        }
+        let ndiv = f64::max(f64::ceil(max_edge_length / target_length), 1.0) as usize;
+
+        // interior points of the coarse edges (a < b; at the fractions k/ndiv from a)
+        // and of the coarse faces (corners sorted; grid order: i, then j)
+        let mut edge_points: HashMap<(i32, i32), Vec<i32>> = HashMap::new();
+        let mut face_points: HashMap<(i32, i32, i32), Vec<i32>> = HashMap::new();
+        for t in 0..ncoarse {
+            for k in 0..4 {
+                for l in (k + 1)..4 {
+                    let (a, b) = (coarse_tets[t * 4 + k], coarse_tets[t * 4 + l]);
+                    let key = (a.min(b), a.max(b));
+                    edge_points.entry(key).or_insert_with(|| {
+                        let mut interior = Vec::with_capacity(ndiv - 1);
+                        for k in 1..ndiv {
+                            let s = (k as f64) / (ndiv as f64);
+                            interior.push((points.len() / 3) as i32);
+                            for dim in 0..3 {
+                                let (xa, xb) = (points[key.0 as usize * 3 + dim], points[key.1 as usize * 3 + dim]);
+                                points.push(xa + s * (xb - xa));
+                            }
+                            markers.push(0);
+                        }
+                        interior
+                    });
+                }
+            }
+            for f in 0..4 {
+                let mut face: Vec<i32> = (0..4).filter(|m| *m != f).map(|m| coarse_tets[t * 4 + m]).collect();
+                face.sort();
+                let key = (face[0], face[1], face[2]);
+                face_points.entry(key).or_insert_with(|| {
+                    let mut interior = Vec::new();
+                    for i in 1..ndiv {
+                        for j in 1..(ndiv - i) {
+                            let (si, sj) = ((i as f64) / (ndiv as f64), (j as f64) / (ndiv as f64));
+                            interior.push((points.len() / 3) as i32);
+                            for dim in 0..3 {
+                                let xa = points[key.0 as usize * 3 + dim];
+                                let xb = points[key.1 as usize * 3 + dim];
+                                let xc = points[key.2 as usize * 3 + dim];
+                                points.push(xa + si * (xb - xa) + sj * (xc - xa));
+                            }
+                            markers.push(0);
+                        }
+                    }
+                    interior
+                });
+            }
+        }
+
+        // the global id of the grid point (i, j) of a face with sorted corners g; the
+        // parametrization runs from g.0 along (g.1 - g.0) with i and (g.2 - g.0) with j,
+        // thus it is identical from both sides of the face
+        let grid_point = |g: (i32, i32, i32), i: usize, j: usize| -> i32 {
+            match (i, j) {
+                (0, 0) => g.0,
+                (i, 0) if i == ndiv => g.1,
+                (0, j) if j == ndiv => g.2,
+                (i, 0) => edge_points[&(g.0, g.1)][i - 1],
+                (0, j) => edge_points[&(g.0, g.2)][j - 1],
+                (i, j) if i + j == ndiv => edge_points[&(g.1, g.2)][ndiv - i - 1],
+                (i, j) => face_points[&g][(i - 1) * (2 * ndiv - i - 2) / 2 + (j - 1)],
+            }
+        };
+
+        // assemble one PLC per coarse tetrahedron: the four faces, each triangulated
+        // with the shared grid (local point ids; the map back to global ids is kept)
+        let mut jobs: Vec<(Vec<i32>, Vec<f64>, Vec<i32>)> = Vec::with_capacity(ncoarse);
+        for t in 0..ncoarse {
+            let mut local_of: HashMap<i32, i32> = HashMap::new();
+            let mut local_to_global: Vec<i32> = Vec::new();
+            let mut coords: Vec<f64> = Vec::new();
+            let mut facet_vertices: Vec<i32> = Vec::new();
+            let push_vertex = |g: i32,
+                               local_of: &mut HashMap<i32, i32>,
+                               local_to_global: &mut Vec<i32>,
+                               coords: &mut Vec<f64>,
+                               facet_vertices: &mut Vec<i32>| {
+                let local = *local_of.entry(g).or_insert_with(|| {
+                    local_to_global.push(g);
+                    for dim in 0..3 {
+                        coords.push(points[(g as usize) * 3 + dim]);
+                    }
+                    (local_to_global.len() - 1) as i32
+                });
+                facet_vertices.push(local);
+            };
+            for f in 0..4 {
+                let mut face: Vec<i32> = (0..4).filter(|m| *m != f).map(|m| coarse_tets[t * 4 + m]).collect();
+                face.sort();
+                let g = (face[0], face[1], face[2]);
+                for i in 0..ndiv {
+                    for j in 0..(ndiv - i) {
+                        for (di, dj) in [(0, 0), (1, 0), (0, 1)] {
+                            push_vertex(
+                                grid_point(g, i + di, j + dj),
+                                &mut local_of,
+                                &mut local_to_global,
+                                &mut coords,
+                                &mut facet_vertices,
+                            );
+                        }
+                        if i + j < ndiv - 1 {
+                            for (di, dj) in [(1, 0), (1, 1), (0, 1)] {
+                                push_vertex(
+                                    grid_point(g, i + di, j + dj),
+                                    &mut local_of,
+                                    &mut local_to_global,
+                                    &mut coords,
+                                    &mut facet_vertices,
+                                );
+                            }
+                        }
+                    }
+                }
+            }
+            jobs.push((local_to_global, coords, facet_vertices));
+        }
+
+        // refine the coarse tetrahedra concurrently
+        let chunk = (ncoarse + nthread - 1) / nthread;
+        let jobs_ref = &jobs;
+        let results: Vec<Vec<(Vec<f64>, Vec<i32>)>> = std::thread::scope(|scope| {
+            let mut handles = Vec::new();
+            for w in 0..nthread {
+                let first = w * chunk;
+                let last = usize::min((w + 1) * chunk, ncoarse);
+                handles.push(scope.spawn(move || -> Result<Vec<(Vec<f64>, Vec<i32>)>, StrError> {
+                    let mut local = Vec::new();
+                    for t in first..last {
+                        let (local_to_global, coords, facet_vertices) = &jobs_ref[t];
+                        let n = local_to_global.len();
+                        let nfacet = facet_vertices.len() / 3;
+                        let mut sub = Tetgen::new(n, Some(vec![3; nfacet]), None, None)?;
+                        sub.set_points_batch(coords, &vec![0; n])?;
+                        let offsets: Vec<i32> = (0..=nfacet).map(|i| (i * 3) as i32).collect();
+                        sub.set_facets_batch(&offsets, facet_vertices, None)?;
+                        // refine the sub-domain without touching its boundary (Y switch;
+                        // M keeps the coplanar grid facets from being merged)
+                        sub.generate_mesh_with(&TetOptions {
+                            global_max_volume: Some(max_volume),
+                            no_bisect: true,
+                            no_merge: true,
+                            ..Default::default()
+                        })?;
+                        // the input points come first in the output, in the same order;
+                        // the indices ≥ n correspond to interior Steiner points
+                        let nsub = sub.out_npoint();
+                        let mut extra = Vec::with_capacity((nsub - n) * 3);
+                        for index in n..nsub {
+                            for dim in 0..3 {
+                                extra.push(sub.out_point(index, dim));
+                            }
+                        }
+                        let mut cells = Vec::with_capacity(sub.out_ncell() * 4);
+                        sub.out_visit_cells(16 * 1024, |_, c| {
+                            cells.extend_from_slice(c);
+                            true
+                        })?;
+                        local.push((extra, cells));
+                    }
+                    Ok(local)
+                }));
+            }
+            handles
+                .into_iter()
+                .map(|h| h.join().unwrap())
+                .collect::<Result<Vec<_>, StrError>>()
+        })?;
+
+        // stitch the sub-meshes into one mesh (the boundary points are shared by
+        // construction, thus only the private interior points need new global ids)
+        let mut tetrahedra = Vec::new();
+        let mut attributes = Vec::new();
+        let mut t = 0;
+        for local in results {
+            for (extra, cells) in local {
+                let local_to_global = &jobs[t].0;
+                let n = local_to_global.len() as i32;
+                let base = (points.len() / 3) as i32;
+                points.extend(extra.iter());
+                markers.extend(std::iter::repeat(0).take(extra.len() / 3));
+                for c in &cells {
+                    tetrahedra.push(if *c < n {
+                        local_to_global[*c as usize]
+                    } else {
+                        base + (*c - n)
+                    });
+                }
+                for _ in 0..cells.len() / 4 {
+                    attributes.push(coarse_attributes[t]);
+                }
+                t += 1;
+            }
+        }
+
+        // install the merged mesh into the output data
+        unsafe {
+            let status = tet_set_output_mesh(
+                self.ext_tetgen,
+                to_i32(points.len() / 3),
+                points.as_ptr(),
+                markers.as_ptr(),
+                to_i32(tetrahedra.len() / 4),
+                tetrahedra.as_ptr(),
+                attributes.as_ptr(),
+            );
+            handle_status(status)?;
+        }
+        Ok(())
+    }
+
+    /// Generates a graded mesh using the previous mesh as a background sizing function
+    ///
+    /// This meshes the PLC with TetGen's 'm' switch: the output of a previous
+    /// [Tetgen::generate_mesh] (or [Tetgen::generate_mesh_with]) run becomes an
+    /// in-memory background mesh and `point_sizes` gives the desired edge length at
+    /// each of its points. Thus, a typical workflow is: generate a coarse mesh,
+    /// compute the desired sizes at its points (e.g., from an error estimate), and
+    /// call this method to regenerate a graded mesh--no file round-trip is needed.
+    /// The previous output is consumed; the new (graded) mesh replaces it.
+    ///
+    /// # Input
+    ///
+    /// * `options` -- The structured options (see [Tetgen::generate_mesh_with])
+    /// * `point_sizes` -- The desired edge length at each point of the previous mesh;
+    ///   the length must equal [Tetgen::out_npoint]
+    pub fn generate_mesh_graded(&mut self, options: &TetOptions, point_sizes: &[f64]) -> Result<(), StrError> {
+        if !self.all_points_set {
+            return Err("cannot generate mesh of tetrahedra because not all points are set");
+        }
+        if !self.all_facets_set {
+            return Err("cannot generate mesh of tetrahedra because not all facets are set");
+        }
+        if point_sizes.len() != self.out_npoint() {
+            return Err("point_sizes.len() must equal the number of points of the previous run");
+        }
+        let ext_options = options.to_ext();
+        unsafe {
+            let status = tet_run_tetrahedralize_bgm(
+                self.ext_tetgen,
+                &ext_options,
+                to_i32(point_sizes.len()),
+                point_sizes.as_ptr(),
+            );
+            handle_status(status)?;
+        }
+        Ok(())
+    }
+
+    /// Refines the previously generated mesh instead of meshing the PLC from scratch
+    ///
+    /// This reconstructs the output of a previous [Tetgen::generate_mesh] (or
+    /// [Tetgen::generate_delaunay]) run with TetGen's 'r' switch and refines it, which
+    /// is much cheaper than a full rebuild when the same domain is refined repeatedly
+    /// (e.g., by an adaptive solver). The refined mesh replaces the previous output;
+    /// thus this method may be called repeatedly.
+    ///
+    /// # Input
+    ///
+    /// * `verbose` -- Prints TetGen's messages to the console
+    /// * `per_cell_max_volume` -- If given, the maximum volume constraint of each
+    ///   tetrahedron of the current mesh; the length must equal [Tetgen::out_ncell]
+    /// * `radius_edge_ratio` -- The maximum radius-edge ratio constraint (TetGen's
+    ///   'q' switch; `None` selects TetGen's default)
+    pub fn refine_mesh(
+        &mut self,
+        verbose: bool,
+        per_cell_max_volume: Option<&[f64]>,
+        radius_edge_ratio: Option<f64>,
+    ) -> Result<(), StrError> {
+        let ncell = self.out_ncell();
+        let volumes = match per_cell_max_volume {
+            Some(v) => {
+                if v.len() != ncell {
+                    return Err("per_cell_max_volume.len() must equal the number of cells of the previous run");
+                }
+                v.as_ptr()
+            }
+            None => std::ptr::null(),
+        };
+        unsafe {
+            let status = tet_run_refine(
+                self.ext_tetgen,
+                if verbose { 1 } else { 0 },
+                to_i32(ncell),
+                volumes,
+                radius_edge_ratio.unwrap_or(0.0),
+            );
+            handle_status(status)?;
+        }
+        Ok(())
+    }
+
     /// Returns the number of (output) points of the Delaunay triangulation (constrained or not)
     pub fn out_npoint(&self) -> usize {
         unsafe { tet_out_npoint(self.ext_tetgen) as usize }
@@ -538,32 +1323,194 @@ impl Tetgen {
         unsafe { tet_out_cell_attribute(self.ext_tetgen, to_i32(index)) as usize }
     }
 
-    /// Returns the number of marked faces
-    pub fn out_n_marked_face(&self) -> usize {
-        unsafe { tet_out_n_marked_face(self.ext_tetgen) as usize }
-    }
-
-    /// Returns a marked face
+    /// Returns the neighbor of a tetrahedron across one of its faces
+    ///
+    /// Returns `-1` if there is no neighbor (boundary face)
     ///
     /// # Input
     ///
-    /// * `index` -- is index of a marked face and goes from `0` to `out_n_marked_face`
+    /// * `index` -- is the index of the tetrahedron and goes from `0` to `out_ncell`
+    /// * `side` -- is the face index: 0, 1, 2, or 3 (opposite to the respective corner)
     ///
-    /// # Output
+    /// # Warning
     ///
-    /// Returns:
+    /// This function is only available after calling [Tetgen::generate_mesh]
+    pub fn out_cell_neighbor(&self, index: usize, side: usize) -> i32 {
+        unsafe { tet_out_cell_neighbor(self.ext_tetgen, to_i32(index), to_i32(side)) }
+    }
+
+    /// Returns a read-only slice with all tetrahedron neighbors (zero-copy)
     ///
-    /// * `points` -- (len = 6) the global IDs of the points on the face; 3 or 6 (if o2)
-    ///   **Note:** The points are ordered as in the figure below; but the face normals
-    ///   are **not** inward or outward, i.e., the face normals are random.
+    /// The slice has a length equal to `out_ncell` times 4 and contains the indices of the
+    /// neighboring tetrahedra (or `-1` on boundary faces), organized as
+    /// `[n0_of_tet0, n1_of_tet0, n2_of_tet0, n3_of_tet0, n0_of_tet1, ...]`.
+    /// The next run frees the list, which is why the run methods take `&mut self`:
+    /// the borrow checker rejects holding this slice across them.
     ///
-    /// ```text
-    ///     NODES
-    ///       2
-    ///      / \     The middle nodes are
-    ///     /   \    only generated if the
-    ///    5     4   quadratic flag is true
-    ///   /       \
+    /// # Warning
+    ///
+    /// This function is only available after calling [Tetgen::generate_mesh];
+    /// otherwise an empty slice is returned
+    pub fn out_neighbors_slice(&self) -> &[i32] {
+        unsafe {
+            let ptr = tet_out_neighbor_list(self.ext_tetgen);
+            let ncell = tet_out_ncell(self.ext_tetgen) as usize;
+            if ptr.is_null() || ncell == 0 {
+                return &[];
+            }
+            std::slice::from_raw_parts(ptr, ncell * 4)
+        }
+    }
+
+    /// Visits the output tetrahedra in chunks of (at most) `chunk_size` cells
+    ///
+    /// The `visitor` closure receives the index of the first cell of the chunk and a
+    /// read-only slice with the chunk's connectivity (zero-copy view into the output
+    /// arrays; `out_cell_npoint` entries per cell). Returning `false` stops the walk.
+    ///
+    /// With a cache-sized chunk (e.g., a few thousand cells), a consumer can convert,
+    /// compress, or write one chunk while the next is still warm in the cache, instead
+    /// of streaming the whole mesh twice. See, e.g., [Tetgen::write_vtu_binary].
+    /// The visitor runs under a shared borrow of `self`, so it cannot call the run
+    /// methods (they take `&mut self`) and free the arrays it is walking.
+    ///
+    /// # Warning
+    ///
+    /// This function is only available after calling [Tetgen::generate_delaunay],
+    /// [Tetgen::generate_mesh], or [Tetgen::generate_refined_mesh]
+    pub fn out_visit_cells<F>(&self, chunk_size: usize, mut visitor: F) -> Result<(), StrError>
+    where
+        F: FnMut(usize, &[i32]) -> bool,
+    {
+        struct Context<'a, F> {
+            nnode: usize,
+            visitor: &'a mut F,
+        }
+        unsafe extern "C" fn trampoline<F>(
+            context: *mut std::os::raw::c_void,
+            start: i32,
+            count: i32,
+            cells: *const i32,
+            _points: *const f64,
+        ) -> i32
+        where
+            F: FnMut(usize, &[i32]) -> bool,
+        {
+            let context = &mut *(context as *mut Context<F>);
+            let chunk = std::slice::from_raw_parts(cells, (count as usize) * context.nnode);
+            if (context.visitor)(start as usize, chunk) {
+                0
+            } else {
+                1 // stop the walk
+            }
+        }
+        if chunk_size < 1 {
+            return Err("chunk_size must be at least 1");
+        }
+        let mut context = Context {
+            nnode: self.out_cell_npoint(),
+            visitor: &mut visitor,
+        };
+        unsafe {
+            let status = tet_out_visit_cells(
+                self.ext_tetgen,
+                trampoline::<F>,
+                &mut context as *mut Context<F> as *mut std::os::raw::c_void,
+                to_i32(chunk_size),
+            );
+            handle_status(status)
+        }
+    }
+
+    /// Returns the histogram of the per-tetrahedron quality (minimum dihedral angle)
+    ///
+    /// The quality of a tetrahedron is its minimum dihedral angle in degrees. The `nbin`
+    /// bins have equal width and span `[0°, 90°)`; larger angles land in the last bin.
+    /// The histogram is computed in one sequential pass inside the C++ layer, so gating
+    /// a solver on mesh quality does not require re-scanning the mesh element by element.
+    ///
+    /// Returns `(histogram, min_quality, max_quality)` with the exact extremes.
+    ///
+    /// # Warning
+    ///
+    /// This function is only available after calling [Tetgen::generate_delaunay],
+    /// [Tetgen::generate_mesh], or [Tetgen::generate_refined_mesh]
+    pub fn out_quality_histogram(&self, nbin: usize) -> Result<(Vec<i64>, f64, f64), StrError> {
+        if nbin < 1 {
+            return Err("nbin must be at least 1");
+        }
+        let mut histogram = vec![0_i64; nbin];
+        let mut min_quality = 0.0;
+        let mut max_quality = 0.0;
+        unsafe {
+            let status = tet_out_quality_histogram(
+                self.ext_tetgen,
+                to_i32(nbin),
+                histogram.as_mut_ptr(),
+                &mut min_quality,
+                &mut max_quality,
+            );
+            handle_status(status)?;
+        }
+        Ok((histogram, min_quality, max_quality))
+    }
+
+    /// Returns the (at most) `nworst` cells of smallest quality, sorted worst first
+    ///
+    /// The quality of a tetrahedron is its minimum dihedral angle in degrees. Each entry
+    /// is `(cell_index, quality)`; fewer than `nworst` entries are returned when the mesh
+    /// has fewer cells. See also [Tetgen::out_quality_histogram].
+    ///
+    /// # Warning
+    ///
+    /// This function is only available after calling [Tetgen::generate_delaunay],
+    /// [Tetgen::generate_mesh], or [Tetgen::generate_refined_mesh]
+    pub fn out_worst_cells(&self, nworst: usize) -> Result<Vec<(usize, f64)>, StrError> {
+        if nworst < 1 {
+            return Err("nworst must be at least 1");
+        }
+        let mut cells = vec![0_i32; nworst];
+        let mut qualities = vec![0.0_f64; nworst];
+        let mut count = 0_i32;
+        unsafe {
+            let status = tet_out_worst_cells(
+                self.ext_tetgen,
+                to_i32(nworst),
+                cells.as_mut_ptr(),
+                qualities.as_mut_ptr(),
+                &mut count,
+            );
+            handle_status(status)?;
+        }
+        Ok((0..count as usize).map(|i| (cells[i] as usize, qualities[i])).collect())
+    }
+
+    /// Returns the number of marked faces
+    pub fn out_n_marked_face(&self) -> usize {
+        unsafe { tet_out_n_marked_face(self.ext_tetgen) as usize }
+    }
+
+    /// Returns a marked face
+    ///
+    /// # Input
+    ///
+    /// * `index` -- is index of a marked face and goes from `0` to `out_n_marked_face`
+    ///
+    /// # Output
+    ///
+    /// Returns:
+    ///
+    /// * `points` -- (len = 6) the global IDs of the points on the face; 3 or 6 (if o2)
+    ///   **Note:** The points are ordered as in the figure below; but the face normals
+    ///   are **not** inward or outward, i.e., the face normals are random.
+    ///
+    /// ```text
+    ///     NODES
+    ///       2
+    ///      / \     The middle nodes are
+    ///     /   \    only generated if the
+    ///    5     4   quadratic flag is true
+    ///   /       \
     ///  /         \
     /// 0-----3-----1
     /// ```
@@ -622,6 +1569,143 @@ impl Tetgen {
         (marker, cell as usize)
     }
 
+    /// Returns the whole marked-face set as flat arrays (zero-copy)
+    ///
+    /// Returns `(points, markers, cells)` where `points` has 6 entries per face (the
+    /// global IDs of the 3 corners, followed by the 3 middle nodes if o2, 0 otherwise),
+    /// and `markers` and `cells` have one entry per face (the marker inherited from the
+    /// PLC and the ID of a tetrahedron touching the face). This is much faster than
+    /// calling [Tetgen::out_marked_face] in a loop because the set crosses the FFI
+    /// boundary once, written in one sequential pass. The slices borrow the underlying
+    /// memory; they are valid until the next generate/refine call.
+    pub fn out_marked_faces(&self) -> (&[i32], &[i32], &[i32]) {
+        let mut points: *const i32 = std::ptr::null();
+        let mut markers: *const i32 = std::ptr::null();
+        let mut cells: *const i32 = std::ptr::null();
+        unsafe {
+            tet_out_marked_faces(self.ext_tetgen, &mut points, &mut markers, &mut cells);
+            let n = self.out_n_marked_face();
+            if points.is_null() || markers.is_null() || cells.is_null() || n == 0 {
+                return (&[], &[], &[]);
+            }
+            (
+                std::slice::from_raw_parts(points, n * 6),
+                std::slice::from_raw_parts(markers, n),
+                std::slice::from_raw_parts(cells, n),
+            )
+        }
+    }
+
+    /// Returns the phase timings and counters captured by the last run
+    ///
+    /// Returns all zeros before the first generate/refine call. Note that the
+    /// timings use the process clock, so they include all threads.
+    pub fn stats(&self) -> TetStats {
+        let mut stats = TetStats::default();
+        unsafe {
+            tet_out_stats(self.ext_tetgen, &mut stats);
+        }
+        stats
+    }
+
+    /// Returns the memory pool usage captured by the last run
+    ///
+    /// Returns all zeros before the first generate/refine call.
+    pub fn pool_stats(&self) -> TetPoolStats {
+        let mut stats = TetPoolStats::default();
+        unsafe {
+            tet_out_pool_stats(self.ext_tetgen, &mut stats);
+        }
+        stats
+    }
+
+    /// Moves the output of the previous run into the input (pointer-wise, zero copies)
+    ///
+    /// Multi-stage pipelines (e.g., mesh, then re-tetrahedralize the refined point set)
+    /// can thus chain entirely inside the C++ layer, instead of reading every array out
+    /// through the `out_*` accessors and pushing it back in through the `set_*` methods.
+    ///
+    /// # Warning
+    ///
+    /// The previous input is released, including the facet, region, and hole definitions;
+    /// the adopted input carries points and tetrahedra but no facets, so the next run is
+    /// typically [Tetgen::generate_delaunay]. The output becomes empty until the next run.
+    pub fn adopt_output_as_input(&mut self) -> Result<(), StrError> {
+        unsafe {
+            let status = tet_adopt_output_as_input(self.ext_tetgen);
+            handle_status(status)?;
+        }
+        Ok(())
+    }
+
+    /// Writes a compact binary snapshot of the output mesh
+    ///
+    /// The snapshot holds a fixed header plus the raw output arrays (points, point
+    /// markers, tetrahedra, attributes, neighbors, and marked faces) in the machine's
+    /// byte order. Reading it back with [Tetgen::read_snapshot] is a handful of bulk
+    /// reads instead of text parsing, giving near-instant restarts from pre-built
+    /// meshes. The file is not portable across machines with different endianness.
+    ///
+    /// # Input
+    ///
+    /// * `full_path` -- may be a String, &str, or Path
+    pub fn write_snapshot<P>(&self, full_path: &P) -> Result<(), StrError>
+    where
+        P: AsRef<std::ffi::OsStr> + ?Sized,
+    {
+        self.write_snapshot_with(full_path, false)
+    }
+
+    /// Writes a binary snapshot with optionally narrowed (f32) coordinates
+    ///
+    /// This works like [Tetgen::write_snapshot] but, with `single_precision`, stores the
+    /// coordinates as f32 instead of f64 (half the bytes on disk; the connectivity and
+    /// the markers are unaffected). [Tetgen::read_snapshot] widens the coordinates back
+    /// to f64 transparently. Use this for visualization or animation archives, where
+    /// seven significant digits are plenty--not for restarts that must reproduce the
+    /// mesh exactly.
+    ///
+    /// # Input
+    ///
+    /// * `full_path` -- may be a String, &str, or Path
+    /// * `single_precision` -- narrows the coordinates to f32 during the write
+    pub fn write_snapshot_with<P>(&self, full_path: &P, single_precision: bool) -> Result<(), StrError>
+    where
+        P: AsRef<std::ffi::OsStr> + ?Sized,
+    {
+        if self.out_ncell() < 1 {
+            return Err("there are no tetrahedra to write");
+        }
+        let path = std::path::Path::new(full_path).to_path_buf();
+        let filename = std::ffi::CString::new(path.to_string_lossy().as_bytes()).map_err(|_| "invalid filename")?;
+        unsafe {
+            let status = tet_write_snapshot(self.ext_tetgen, filename.as_ptr(), if single_precision { 1 } else { 0 });
+            handle_status(status)?;
+        }
+        Ok(())
+    }
+
+    /// Reads a snapshot written by [Tetgen::write_snapshot], replacing the output mesh
+    ///
+    /// After this call, the `out_*` accessors (and, e.g., [Tetgen::refine_mesh] or the
+    /// Paraview writers) see the restored mesh just as if it had been generated.
+    ///
+    /// # Input
+    ///
+    /// * `full_path` -- may be a String, &str, or Path
+    pub fn read_snapshot<P>(&mut self, full_path: &P) -> Result<(), StrError>
+    where
+        P: AsRef<std::ffi::OsStr> + ?Sized,
+    {
+        let path = std::path::Path::new(full_path).to_path_buf();
+        let filename = std::ffi::CString::new(path.to_string_lossy().as_bytes()).map_err(|_| "invalid filename")?;
+        unsafe {
+            let status = tet_read_snapshot(self.ext_tetgen, filename.as_ptr());
+            handle_status(status)?;
+        }
+        Ok(())
+    }
+
     /// Draws wireframe representing the edges of tetrahedra
     pub fn draw_wireframe(
         &self,
@@ -765,9 +1849,10 @@ impl Tetgen {
 
 #[cfg(test)]
 mod tests {
-    use super::Tetgen;
+    use super::{TetOptions, TetPoolStats, TetStats, Tetgen};
     use crate::StrError;
     use plotpy::Plot;
+    use std::collections::HashMap;
 
     const SAVE_FIGURE: bool = false;
 
@@ -799,6 +1884,479 @@ mod tests {
         Ok(())
     }
 
+    #[test]
+    fn set_batch_captures_some_errors() -> Result<(), StrError> {
+        let mut tetgen = Tetgen::new(4, None, None, None)?;
+        assert_eq!(
+            tetgen.set_points_batch(&[0.0, 0.0], &[0; 4]).err(),
+            Some("coords.len() must be equal to 3 · npoint")
+        );
+        assert_eq!(
+            tetgen.set_points_batch(&[0.0; 12], &[0; 3]).err(),
+            Some("markers.len() must be equal to npoint")
+        );
+        assert_eq!(
+            tetgen.set_facets_batch(&[0], &[], None).err(),
+            Some("cannot set facet point because facet_npoint is None")
+        );
+        let mut tetgen = Tetgen::new(4, Some(vec![3, 3, 3, 3]), None, None)?;
+        assert_eq!(
+            tetgen.set_facets_batch(&[0, 3], &[0, 1, 2], None).err(),
+            Some("offsets.len() must be equal to nfacet + 1")
+        );
+        assert_eq!(
+            tetgen.set_facets_batch(&[0, 3, 6, 9, 13], &[0; 12], None).err(),
+            Some("offsets must start at 0 and end at vertices.len()")
+        );
+        assert_eq!(
+            tetgen
+                .set_facets_batch(&[0, 3, 6, 9, 12], &[0; 12], Some(&[0; 3]))
+                .err(),
+            Some("markers.len() must be equal to nfacet")
+        );
+        let mut vertices = vec![0; 12];
+        vertices[11] = 5;
+        assert_eq!(
+            tetgen.set_facets_batch(&[0, 3, 6, 9, 12], &vertices, None).err(),
+            Some("id of facet point is out of bounds")
+        );
+        Ok(())
+    }
+
+    #[test]
+    fn set_batch_works() -> Result<(), StrError> {
+        let mut tetgen = Tetgen::new(4, Some(vec![3, 3, 3, 3]), None, None)?;
+        tetgen.set_points_batch(
+            &[
+                0.0, 1.0, 0.0, //
+                0.0, 0.0, 0.0, //
+                1.0, 1.0, 0.0, //
+                0.0, 1.0, 1.0, //
+            ],
+            &[0, 0, 0, 0],
+        )?;
+        tetgen.set_facets_batch(
+            &[0, 3, 6, 9, 12],
+            &[
+                0, 2, 1, //
+                0, 1, 3, //
+                0, 3, 2, //
+                1, 2, 3, //
+            ],
+            Some(&[-10, -20, -30, -40]),
+        )?;
+        tetgen.generate_mesh(false, false, None, None)?;
+        assert!(tetgen.out_npoint() >= 4);
+        assert!(tetgen.out_ncell() >= 1);
+        Ok(())
+    }
+
+    #[test]
+    fn out_neighbors_work() -> Result<(), StrError> {
+        let mut tetgen = Tetgen::new(4, Some(vec![3, 3, 3, 3]), None, None)?;
+        assert_eq!(tetgen.out_neighbors_slice(), &[] as &[i32]);
+        assert_eq!(tetgen.out_cell_neighbor(0, 0), -1);
+        tetgen.set_points_batch(
+            &[
+                0.0, 1.0, 0.0, //
+                0.0, 0.0, 0.0, //
+                1.0, 1.0, 0.0, //
+                0.0, 1.0, 1.0, //
+            ],
+            &[0, 0, 0, 0],
+        )?;
+        tetgen.set_facets_batch(
+            &[0, 3, 6, 9, 12],
+            &[
+                0, 2, 1, //
+                0, 1, 3, //
+                0, 3, 2, //
+                1, 2, 3, //
+            ],
+            None,
+        )?;
+        tetgen.generate_mesh(false, false, None, None)?;
+        let ncell = tetgen.out_ncell();
+        let neighbors = tetgen.out_neighbors_slice();
+        assert_eq!(neighbors.len(), ncell * 4);
+        // every entry is either -1 (boundary face) or a valid cell index,
+        // and the adjacency is symmetric
+        for t in 0..ncell {
+            for side in 0..4 {
+                let nb = neighbors[t * 4 + side];
+                assert_eq!(tetgen.out_cell_neighbor(t, side), nb);
+                assert!(nb >= -1 && nb < ncell as i32);
+                if nb >= 0 {
+                    let row = &neighbors[(nb as usize) * 4..(nb as usize) * 4 + 4];
+                    assert!(row.contains(&(t as i32)));
+                }
+            }
+        }
+        Ok(())
+    }
+
+    #[test]
+    fn out_visit_cells_works() -> Result<(), StrError> {
+        let mut tetgen = Tetgen::new(4, Some(vec![3, 3, 3, 3]), None, None)?;
+        assert_eq!(
+            tetgen.out_visit_cells(1, |_, _| true).err(),
+            Some("there is no tetrahedral mesh from a previous run")
+        );
+        tetgen.set_points_batch(
+            &[
+                0.0, 1.0, 0.0, //
+                0.0, 0.0, 0.0, //
+                1.0, 1.0, 0.0, //
+                0.0, 1.0, 1.0, //
+            ],
+            &[0, 0, 0, 0],
+        )?;
+        tetgen.set_facets_batch(
+            &[0, 3, 6, 9, 12],
+            &[
+                0, 2, 1, //
+                0, 1, 3, //
+                0, 3, 2, //
+                1, 2, 3, //
+            ],
+            None,
+        )?;
+        tetgen.generate_mesh(false, false, Some(0.01), None)?;
+        let ncell = tetgen.out_ncell();
+        assert!(ncell > 3);
+        assert_eq!(
+            tetgen.out_visit_cells(0, |_, _| true).err(),
+            Some("chunk_size must be at least 1")
+        );
+        // the chunks, concatenated, must reproduce the per-cell accessors
+        // (for linear tetrahedra the raw corner order matches out_cell_point)
+        let mut nvisit = 0;
+        let mut connectivity = Vec::new();
+        tetgen.out_visit_cells(3, |start, chunk| {
+            assert_eq!(start, connectivity.len() / 4);
+            nvisit += 1;
+            connectivity.extend_from_slice(chunk);
+            true
+        })?;
+        assert_eq!(nvisit, (ncell + 2) / 3);
+        assert_eq!(connectivity.len(), ncell * 4);
+        for index in 0..ncell {
+            for m in 0..4 {
+                assert_eq!(connectivity[index * 4 + m] as usize, tetgen.out_cell_point(index, m));
+            }
+        }
+        // returning false stops the walk early
+        let mut nvisit = 0;
+        tetgen.out_visit_cells(1, |_, _| {
+            nvisit += 1;
+            false
+        })?;
+        assert_eq!(nvisit, 1);
+        Ok(())
+    }
+
+    #[test]
+    fn adopt_output_as_input_works() -> Result<(), StrError> {
+        let mut tetgen = Tetgen::new(4, Some(vec![3, 3, 3, 3]), None, None)?;
+        assert_eq!(
+            tetgen.adopt_output_as_input().err(),
+            Some("there is no tetrahedral mesh from a previous run")
+        );
+        tetgen.set_points_batch(
+            &[
+                0.0, 1.0, 0.0, //
+                0.0, 0.0, 0.0, //
+                1.0, 1.0, 0.0, //
+                0.0, 1.0, 1.0, //
+            ],
+            &[0, 0, 0, 0],
+        )?;
+        tetgen.set_facets_batch(
+            &[0, 3, 6, 9, 12],
+            &[
+                0, 2, 1, //
+                0, 1, 3, //
+                0, 3, 2, //
+                1, 2, 3, //
+            ],
+            None,
+        )?;
+        tetgen.generate_mesh(false, false, Some(0.01), None)?;
+        let npoint = tetgen.out_npoint();
+        assert!(npoint > 4);
+        // the refined point set becomes the input; the output is consumed
+        tetgen.adopt_output_as_input()?;
+        assert_eq!(tetgen.out_npoint(), 0);
+        assert_eq!(tetgen.out_ncell(), 0);
+        // re-tetrahedralize (Delaunay) the adopted points without any round-trip
+        tetgen.generate_delaunay(false, true)?;
+        assert_eq!(tetgen.out_npoint(), npoint);
+        assert!(tetgen.out_ncell() > 0);
+        Ok(())
+    }
+
+    #[test]
+    fn quality_stats_works() -> Result<(), StrError> {
+        let mut tetgen = Tetgen::new(4, Some(vec![3, 3, 3, 3]), None, None)?;
+        assert_eq!(tetgen.out_quality_histogram(0).err(), Some("nbin must be at least 1"));
+        assert_eq!(tetgen.out_worst_cells(0).err(), Some("nworst must be at least 1"));
+        assert_eq!(
+            tetgen.out_quality_histogram(9).err(),
+            Some("there is no tetrahedral mesh from a previous run")
+        );
+        tetgen.set_points_batch(
+            &[
+                0.0, 1.0, 0.0, //
+                0.0, 0.0, 0.0, //
+                1.0, 1.0, 0.0, //
+                0.0, 1.0, 1.0, //
+            ],
+            &[0, 0, 0, 0],
+        )?;
+        tetgen.set_facets_batch(
+            &[0, 3, 6, 9, 12],
+            &[
+                0, 2, 1, //
+                0, 1, 3, //
+                0, 3, 2, //
+                1, 2, 3, //
+            ],
+            None,
+        )?;
+        tetgen.generate_mesh(false, false, Some(0.01), None)?;
+        let ncell = tetgen.out_ncell();
+        assert!(ncell > 5);
+        let (histogram, min_quality, max_quality) = tetgen.out_quality_histogram(9)?;
+        assert_eq!(histogram.iter().sum::<i64>(), ncell as i64);
+        // the minimum dihedral angle of any tetrahedron is at most ~70.53 degrees
+        assert!(min_quality > 0.0 && min_quality <= max_quality && max_quality < 71.0);
+        // the worst cells come back sorted, worst first, and agree with the extremes
+        let worst = tetgen.out_worst_cells(5)?;
+        assert_eq!(worst.len(), 5);
+        assert!(f64::abs(worst[0].1 - min_quality) < 1e-15);
+        for i in 0..worst.len() {
+            let (cell, quality) = worst[i];
+            assert!(cell < ncell);
+            assert!(quality >= min_quality && quality <= max_quality);
+            if i > 0 {
+                assert!(worst[i - 1].1 <= quality);
+            }
+        }
+        // asking for more than ncell returns exactly ncell entries
+        assert_eq!(tetgen.out_worst_cells(ncell + 10)?.len(), ncell);
+        Ok(())
+    }
+
+    #[test]
+    fn mesh_parallel_works() -> Result<(), StrError> {
+        let mut tetgen = Tetgen::new(8, Some(vec![4; 6]), None, None)?;
+        tetgen.set_points_batch(
+            &[
+                0.0, 0.0, 0.0, //
+                1.0, 0.0, 0.0, //
+                1.0, 1.0, 0.0, //
+                0.0, 1.0, 0.0, //
+                0.0, 0.0, 1.0, //
+                1.0, 0.0, 1.0, //
+                1.0, 1.0, 1.0, //
+                0.0, 1.0, 1.0, //
+            ],
+            &[0; 8],
+        )?;
+        tetgen.set_facets_batch(
+            &[0, 4, 8, 12, 16, 20, 24],
+            &[
+                0, 4, 7, 3, // -x
+                1, 2, 6, 5, // +x
+                0, 1, 5, 4, // -y
+                2, 3, 7, 6, // +y
+                0, 3, 2, 1, // -z
+                4, 5, 6, 7, // +z
+            ],
+            None,
+        )?;
+        tetgen.generate_mesh_parallel(false, Some(0.005), 3)?;
+        assert!(tetgen.out_ncell() >= 200); // total volume is 1.0 and max volume is 0.005
+                                            // the tetrahedra are consistently oriented and cover the whole cube
+        let volume_of = |tetgen: &Tetgen, t: usize| -> f64 {
+            let mut x = [[0.0; 3]; 4];
+            for m in 0..4 {
+                for dim in 0..3 {
+                    x[m][dim] = tetgen.out_point(tetgen.out_cell_point(t, m), dim);
+                }
+            }
+            let u = [x[1][0] - x[0][0], x[1][1] - x[0][1], x[1][2] - x[0][2]];
+            let v = [x[2][0] - x[0][0], x[2][1] - x[0][1], x[2][2] - x[0][2]];
+            let w = [x[3][0] - x[0][0], x[3][1] - x[0][1], x[3][2] - x[0][2]];
+            ((u[1] * v[2] - u[2] * v[1]) * w[0]
+                + (u[2] * v[0] - u[0] * v[2]) * w[1]
+                + (u[0] * v[1] - u[1] * v[0]) * w[2])
+                / 6.0
+        };
+        let mut total_volume = 0.0;
+        for t in 0..tetgen.out_ncell() {
+            let volume = volume_of(&tetgen, t);
+            assert!(volume > 0.0);
+            total_volume += volume;
+        }
+        assert!(f64::abs(total_volume - 1.0) < 1e-12);
+        // the sub-meshes are conforming: every face appears either twice (interior)
+        // or once, in which case it must lie on the surface of the cube
+        let mut face_count: HashMap<[usize; 3], usize> = HashMap::new();
+        for t in 0..tetgen.out_ncell() {
+            for f in 0..4 {
+                let mut face: Vec<usize> = (0..4)
+                    .filter(|m| *m != f)
+                    .map(|m| tetgen.out_cell_point(t, m))
+                    .collect();
+                face.sort();
+                *face_count.entry([face[0], face[1], face[2]]).or_insert(0) += 1;
+            }
+        }
+        for (face, count) in &face_count {
+            assert!(*count == 1 || *count == 2);
+            if *count == 1 {
+                let on_surface = (0..3).any(|dim| {
+                    [0.0, 1.0]
+                        .iter()
+                        .any(|value| face.iter().all(|p| tetgen.out_point(*p, dim) == *value))
+                });
+                assert!(on_surface);
+            }
+        }
+        // the mesher can run again with different constraints
+        tetgen.generate_mesh_parallel(false, Some(0.05), 2)?;
+        assert!(tetgen.out_ncell() >= 20);
+        tetgen.generate_mesh_parallel(false, None, 2)?;
+        assert!(tetgen.out_ncell() >= 5);
+        Ok(())
+    }
+
+    #[test]
+    fn hull_works() -> Result<(), StrError> {
+        // cube corners plus an interior point (which must not appear on the hull)
+        let mut tetgen = Tetgen::new(9, None, None, None)?;
+        tetgen.set_points_batch(
+            &[
+                0.0, 0.0, 0.0, //
+                1.0, 0.0, 0.0, //
+                1.0, 1.0, 0.0, //
+                0.0, 1.0, 0.0, //
+                0.0, 0.0, 1.0, //
+                1.0, 0.0, 1.0, //
+                1.0, 1.0, 1.0, //
+                0.0, 1.0, 1.0, //
+                0.5, 0.5, 0.5, //
+            ],
+            &[0; 9],
+        )?;
+        tetgen.generate_hull(false, true)?;
+        assert!(tetgen.out_ncell() >= 1);
+
+        // the cube surface triangulates into 12 hull faces
+        let n_hull = tetgen.out_n_marked_face();
+        assert_eq!(n_hull, 12);
+        let (points, markers, cells) = tetgen.out_marked_faces();
+        assert_eq!(points.len(), n_hull * 6);
+        for f in 0..n_hull {
+            // every vertex of a hull face lies on the cube surface (not the center)
+            for m in 0..3 {
+                let p = points[f * 6 + m] as usize;
+                assert!(p < 8);
+            }
+            assert_eq!(markers[f], 1);
+            assert_eq!(cells[f], -1);
+        }
+
+        // the hull faces are outward-pointing: the interior point is behind each face
+        for f in 0..n_hull {
+            let mut x = [[0.0; 3]; 3];
+            for m in 0..3 {
+                for dim in 0..3 {
+                    x[m][dim] = tetgen.out_point(points[f * 6 + m] as usize, dim);
+                }
+            }
+            let u = [x[1][0] - x[0][0], x[1][1] - x[0][1], x[1][2] - x[0][2]];
+            let v = [x[2][0] - x[0][0], x[2][1] - x[0][1], x[2][2] - x[0][2]];
+            let normal = [
+                u[1] * v[2] - u[2] * v[1],
+                u[2] * v[0] - u[0] * v[2],
+                u[0] * v[1] - u[1] * v[0],
+            ];
+            let to_center = [0.5 - x[0][0], 0.5 - x[0][1], 0.5 - x[0][2]];
+            let dot = normal[0] * to_center[0] + normal[1] * to_center[1] + normal[2] * to_center[2];
+            assert!(dot < 0.0);
+        }
+        Ok(())
+    }
+
+    #[test]
+    fn rerun_works() -> Result<(), StrError> {
+        let mut tetgen = Tetgen::new(4, None, None, None)?;
+        tetgen.set_points_batch(
+            &[
+                0.0, 1.0, 0.0, //
+                0.0, 0.0, 0.0, //
+                1.0, 1.0, 0.0, //
+                0.0, 1.0, 1.0, //
+            ],
+            &[0, 0, 0, 0],
+        )?;
+        tetgen.generate_delaunay(false, true)?;
+        assert_eq!(tetgen.out_npoint(), 4);
+        assert_eq!(tetgen.out_ncell(), 1);
+        // rerun with new coordinates; the previous output is released first
+        tetgen.set_points_batch(
+            &[
+                0.0, 2.0, 0.0, //
+                0.0, 0.0, 0.0, //
+                2.0, 2.0, 0.0, //
+                0.0, 2.0, 2.0, //
+            ],
+            &[0, 0, 0, 0],
+        )?;
+        tetgen.generate_delaunay(false, true)?;
+        assert_eq!(tetgen.out_npoint(), 4);
+        assert_eq!(tetgen.out_ncell(), 1);
+        assert_eq!(tetgen.out_point(2, 0), 2.0);
+        Ok(())
+    }
+
+    #[test]
+    fn instances_run_concurrently() -> Result<(), StrError> {
+        // Tetgen is Send: instances can be moved to other threads and run in parallel
+        let mut handles = Vec::new();
+        for i in 0..4 {
+            let delta = i as f64;
+            let mut tetgen = Tetgen::new(4, None, None, None)?;
+            tetgen.set_points_batch(
+                &[
+                    0.0,
+                    1.0 + delta,
+                    0.0, //
+                    0.0,
+                    0.0,
+                    0.0, //
+                    1.0 + delta,
+                    1.0 + delta,
+                    0.0, //
+                    0.0,
+                    1.0 + delta,
+                    1.0 + delta, //
+                ],
+                &[0, 0, 0, 0],
+            )?;
+            handles.push(std::thread::spawn(move || {
+                tetgen.generate_delaunay(false, true).unwrap();
+                tetgen.out_point(2, 0)
+            }));
+        }
+        for (i, handle) in handles.into_iter().enumerate() {
+            assert_eq!(handle.join().unwrap(), 1.0 + i as f64);
+        }
+        Ok(())
+    }
+
     #[test]
     fn set_point_captures_some_errors() -> Result<(), StrError> {
         let mut tetgen = Tetgen::new(4, None, None, None)?;
@@ -866,7 +2424,7 @@ mod tests {
     fn generate_methods_capture_some_errors() -> Result<(), StrError> {
         let mut tetgen = Tetgen::new(4, Some(vec![3, 3, 3, 3]), None, None)?;
         assert_eq!(
-            tetgen.generate_delaunay(false).err(),
+            tetgen.generate_delaunay(false, true).err(),
             Some("cannot generate Delaunay tetrahedralization because not all points are set")
         );
         assert_eq!(
@@ -893,9 +2451,27 @@ mod tests {
             .set_point(1, 0, 1.0, 0.0, 0.0)?
             .set_point(2, 0, 0.0, 1.0, 0.0)?
             .set_point(3, 0, 0.0, 0.0, 1.0)?;
-        tetgen.generate_delaunay(false)?;
+        tetgen.generate_delaunay(false, true)?;
+        assert_eq!(tetgen.out_ncell(), 1);
+        assert_eq!(tetgen.out_npoint(), 4);
+        Ok(())
+    }
+
+    #[test]
+    fn generate_delaunay_inexact_works() -> Result<(), StrError> {
+        // well-separated points: the inexact fast path must match the exact result
+        let mut tetgen = Tetgen::new(4, None, None, None)?;
+        tetgen
+            .set_point(0, 0, 0.0, 0.0, 0.0)?
+            .set_point(1, 0, 1.0, 0.0, 0.0)?
+            .set_point(2, 0, 0.0, 1.0, 0.0)?
+            .set_point(3, 0, 0.0, 0.0, 1.0)?;
+        tetgen.generate_delaunay(false, false)?;
         assert_eq!(tetgen.out_ncell(), 1);
         assert_eq!(tetgen.out_npoint(), 4);
+        // fall back to the exact path (rerun releases the previous output)
+        tetgen.generate_delaunay(false, true)?;
+        assert_eq!(tetgen.out_ncell(), 1);
         Ok(())
     }
 
@@ -907,7 +2483,7 @@ mod tests {
             .set_point(1, 0, 1.0, 0.0, 0.0)?
             .set_point(2, 0, 0.0, 1.0, 0.0)?
             .set_point(3, 0, 0.0, 0.0, 1.0)?;
-        tetgen.generate_delaunay(false)?;
+        tetgen.generate_delaunay(false, true)?;
         assert_eq!(tetgen.out_ncell(), 1);
         assert_eq!(tetgen.out_npoint(), 4);
         let mut plot = Plot::new();
@@ -932,7 +2508,7 @@ mod tests {
             .set_point(5, -600, 1.0, 0.0, 1.0)?
             .set_point(6, -700, 1.0, 1.0, 1.0)?
             .set_point(7, -800, 0.0, 1.0, 1.0)?;
-        tetgen.generate_delaunay(false)?;
+        tetgen.generate_delaunay(false, true)?;
         assert_eq!(tetgen.out_ncell(), 6);
         assert_eq!(tetgen.out_npoint(), 8);
         let mut plot = Plot::new();
@@ -1077,6 +2653,367 @@ mod tests {
             assert_eq!(marked_faces[i].points, correct[i].1);
             assert_eq!(marked_faces[i].marker, correct[i].2);
         }
+
+        // the bulk export must match the per-face export
+        let (all_points, all_markers, all_cells) = tetgen.out_marked_faces();
+        assert_eq!(all_markers.len(), 12);
+        assert_eq!(all_cells.len(), 12);
+        let mut points = [0; 6];
+        for i in 0..12 {
+            let (marker, cell) = tetgen.out_marked_face(i, &mut points);
+            assert_eq!(&all_points[i * 6..(i + 1) * 6], &points);
+            assert_eq!(all_markers[i], marker);
+            assert_eq!(all_cells[i], cell as i32);
+        }
+        Ok(())
+    }
+
+    #[test]
+    fn generate_mesh_with_captures_some_errors() -> Result<(), StrError> {
+        let mut tetgen = Tetgen::new(4, Some(vec![3, 3, 3, 3]), None, None)?;
+        let options = TetOptions::default();
+        assert_eq!(
+            tetgen.generate_mesh_with(&options).err(),
+            Some("cannot generate mesh of tetrahedra because not all points are set")
+        );
+        tetgen
+            .set_point(0, 0, 0.0, 0.0, 0.0)?
+            .set_point(1, 0, 1.0, 0.0, 0.0)?
+            .set_point(2, 0, 0.0, 1.0, 0.0)?
+            .set_point(3, 0, 0.0, 0.0, 1.0)?;
+        assert_eq!(
+            tetgen.generate_mesh_with(&options).err(),
+            Some("cannot generate mesh of tetrahedra because not all facets are set")
+        );
+        Ok(())
+    }
+
+    #[test]
+    fn generate_mesh_with_works() -> Result<(), StrError> {
+        let mut tetgen = Tetgen::new(4, Some(vec![3, 3, 3, 3]), None, None)?;
+        tetgen
+            .set_point(0, 0, 0.0, 0.0, 0.0)?
+            .set_point(1, 0, 1.0, 0.0, 0.0)?
+            .set_point(2, 0, 0.0, 1.0, 0.0)?
+            .set_point(3, 0, 0.0, 0.0, 1.0)?;
+        tetgen
+            .set_facet_point(0, 0, 0)?
+            .set_facet_point(0, 1, 2)?
+            .set_facet_point(0, 2, 1)?;
+        tetgen
+            .set_facet_point(1, 0, 0)?
+            .set_facet_point(1, 1, 1)?
+            .set_facet_point(1, 2, 3)?;
+        tetgen
+            .set_facet_point(2, 0, 0)?
+            .set_facet_point(2, 1, 3)?
+            .set_facet_point(2, 2, 2)?;
+        tetgen
+            .set_facet_point(3, 0, 1)?
+            .set_facet_point(3, 1, 2)?
+            .set_facet_point(3, 2, 3)?;
+
+        // with a Steiner point cap of zero, refinement cannot add points
+        let mut options = TetOptions::default();
+        options.global_max_volume = Some(0.01);
+        options.max_steiner_points = Some(0);
+        tetgen.generate_mesh_with(&options)?;
+        assert_eq!(tetgen.out_ncell(), 1);
+        assert_eq!(tetgen.out_npoint(), 4);
+
+        // without the cap, the volume constraint leads to a refined mesh
+        options.max_steiner_points = None;
+        tetgen.generate_mesh_with(&options)?;
+        assert!(tetgen.out_ncell() > 1);
+        assert!(tetgen.out_npoint() > 4);
+
+        // rerun with quality and optimization levers
+        options.min_dihedral_angle = Some(12.0);
+        options.radius_edge_ratio = Some(2.0);
+        options.optimization_level = Some(3);
+        options.optimization_scheme = Some(7);
+        options.o2 = true;
+        tetgen.generate_mesh_with(&options)?;
+        assert!(tetgen.out_ncell() > 1);
+        assert_eq!(tetgen.out_cell_npoint(), 10);
+        Ok(())
+    }
+
+    #[test]
+    fn refine_mesh_captures_some_errors() -> Result<(), StrError> {
+        let mut tetgen = Tetgen::new(4, None, None, None)?;
+        assert_eq!(
+            tetgen.refine_mesh(false, None, None).err(),
+            Some("there is no tetrahedral mesh from a previous run")
+        );
+        tetgen
+            .set_point(0, 0, 0.0, 0.0, 0.0)?
+            .set_point(1, 0, 1.0, 0.0, 0.0)?
+            .set_point(2, 0, 0.0, 1.0, 0.0)?
+            .set_point(3, 0, 0.0, 0.0, 1.0)?;
+        tetgen.generate_delaunay(false, true)?;
+        assert_eq!(
+            tetgen.refine_mesh(false, Some(&[0.01, 0.01]), None).err(),
+            Some("per_cell_max_volume.len() must equal the number of cells of the previous run")
+        );
+        Ok(())
+    }
+
+    #[test]
+    fn refine_mesh_works() -> Result<(), StrError> {
+        let mut tetgen = Tetgen::new(8, Some(vec![4, 4, 4, 4, 4, 4]), None, None)?;
+        tetgen
+            .set_point(0, 0, 0.0, 0.0, 0.0)?
+            .set_point(1, 0, 1.0, 0.0, 0.0)?
+            .set_point(2, 0, 1.0, 1.0, 0.0)?
+            .set_point(3, 0, 0.0, 1.0, 0.0)?
+            .set_point(4, 0, 0.0, 0.0, 1.0)?
+            .set_point(5, 0, 1.0, 0.0, 1.0)?
+            .set_point(6, 0, 1.0, 1.0, 1.0)?
+            .set_point(7, 0, 0.0, 1.0, 1.0)?;
+        tetgen
+            .set_facet_point(0, 0, 0)?
+            .set_facet_point(0, 1, 4)?
+            .set_facet_point(0, 2, 7)?
+            .set_facet_point(0, 3, 3)?; // -x
+        tetgen
+            .set_facet_point(1, 0, 1)?
+            .set_facet_point(1, 1, 2)?
+            .set_facet_point(1, 2, 6)?
+            .set_facet_point(1, 3, 5)?; // +x
+        tetgen
+            .set_facet_point(2, 0, 0)?
+            .set_facet_point(2, 1, 1)?
+            .set_facet_point(2, 2, 5)?
+            .set_facet_point(2, 3, 4)?; // -y
+        tetgen
+            .set_facet_point(3, 0, 2)?
+            .set_facet_point(3, 1, 3)?
+            .set_facet_point(3, 2, 7)?
+            .set_facet_point(3, 3, 6)?; // +y
+        tetgen
+            .set_facet_point(4, 0, 0)?
+            .set_facet_point(4, 1, 3)?
+            .set_facet_point(4, 2, 2)?
+            .set_facet_point(4, 3, 1)?; // -z
+        tetgen
+            .set_facet_point(5, 0, 4)?
+            .set_facet_point(5, 1, 5)?
+            .set_facet_point(5, 2, 6)?
+            .set_facet_point(5, 3, 7)?; // +z
+        tetgen.generate_mesh(false, false, None, None)?;
+        let ncell_coarse = tetgen.out_ncell();
+        assert_eq!(ncell_coarse, 6);
+
+        // adaptive refinement: small volumes near x = 0, coarse elsewhere
+        for _ in 0..2 {
+            let ncell = tetgen.out_ncell();
+            let volumes: Vec<f64> = (0..ncell)
+                .map(|t| {
+                    let xc = (0..4)
+                        .map(|m| tetgen.out_point(tetgen.out_cell_point(t, m), 0))
+                        .sum::<f64>()
+                        / 4.0;
+                    if xc < 0.5 {
+                        0.002
+                    } else {
+                        0.05
+                    }
+                })
+                .collect();
+            tetgen.refine_mesh(false, Some(&volumes), None)?;
+            assert!(tetgen.out_ncell() > ncell);
+        }
+        assert!(tetgen.out_npoint() > 8);
+
+        // a quality-only pass leaves the cell volumes unconstrained
+        tetgen.refine_mesh(false, None, Some(1.5))?;
+        assert!(tetgen.out_ncell() > ncell_coarse);
+
+        // use the refined mesh as a background sizing function: fine near x = 0
+        let npoint = tetgen.out_npoint();
+        let sizes: Vec<f64> = (0..npoint)
+            .map(|p| if tetgen.out_point(p, 0) < 0.5 { 0.1 } else { 0.4 })
+            .collect();
+        tetgen.generate_mesh_graded(&TetOptions::default(), &sizes)?;
+        let ncell = tetgen.out_ncell();
+        assert!(ncell > ncell_coarse);
+        let nleft = (0..ncell)
+            .filter(|t| {
+                let xc = (0..4)
+                    .map(|m| tetgen.out_point(tetgen.out_cell_point(*t, m), 0))
+                    .sum::<f64>()
+                    / 4.0;
+                xc < 0.5
+            })
+            .count();
+        assert!(nleft > ncell - nleft); // more (smaller) cells where the sizing is finer
+
+        // the sizes must match the previous output
+        assert_eq!(
+            tetgen.generate_mesh_graded(&TetOptions::default(), &[0.1]).err(),
+            Some("point_sizes.len() must equal the number of points of the previous run")
+        );
+        Ok(())
+    }
+
+    #[test]
+    fn stats_work() -> Result<(), StrError> {
+        let mut tetgen = Tetgen::new(4, Some(vec![3, 3, 3, 3]), None, None)?;
+        assert_eq!(tetgen.stats(), TetStats::default()); // all zeros before any run
+        assert_eq!(tetgen.pool_stats(), TetPoolStats::default());
+        tetgen
+            .set_point(0, 0, 0.0, 0.0, 0.0)?
+            .set_point(1, 0, 1.0, 0.0, 0.0)?
+            .set_point(2, 0, 0.0, 1.0, 0.0)?
+            .set_point(3, 0, 0.0, 0.0, 1.0)?;
+        tetgen
+            .set_facet_point(0, 0, 0)?
+            .set_facet_point(0, 1, 2)?
+            .set_facet_point(0, 2, 1)?;
+        tetgen
+            .set_facet_point(1, 0, 0)?
+            .set_facet_point(1, 1, 1)?
+            .set_facet_point(1, 2, 3)?;
+        tetgen
+            .set_facet_point(2, 0, 0)?
+            .set_facet_point(2, 1, 3)?
+            .set_facet_point(2, 2, 2)?;
+        tetgen
+            .set_facet_point(3, 0, 1)?
+            .set_facet_point(3, 1, 2)?
+            .set_facet_point(3, 2, 3)?;
+        tetgen.generate_mesh(false, false, Some(0.01), None)?;
+        let stats = tetgen.stats();
+        assert_eq!(stats.points_inserted as usize, tetgen.out_npoint() - 4);
+        assert!(stats.steiner_on_segments + stats.steiner_on_facets + stats.steiner_in_volume > 0);
+        assert!(stats.flips > 0);
+        assert!(stats.total_seconds >= stats.delaunay_seconds);
+        assert!(stats.total_seconds >= stats.refinement_seconds);
+        assert_eq!(stats.duplicated_vertices, 0);
+        assert_eq!(stats.unused_vertices, 0);
+        let pools = tetgen.pool_stats();
+        assert!(pools.points_max_items >= tetgen.out_npoint() as i64);
+        assert!(pools.tetrahedrons_max_items >= tetgen.out_ncell() as i64);
+        assert!(pools.subfaces_max_items > 0);
+        assert!(pools.pool_peak_bytes > 0);
+        Ok(())
+    }
+
+    #[test]
+    fn snapshot_roundtrip_works() -> Result<(), StrError> {
+        let mut tetgen = Tetgen::new(4, Some(vec![3, 3, 3, 3]), None, None)?;
+        tetgen
+            .set_point(0, 0, 0.0, 0.0, 0.0)?
+            .set_point(1, 0, 1.0, 0.0, 0.0)?
+            .set_point(2, 0, 0.0, 1.0, 0.0)?
+            .set_point(3, 0, 0.0, 0.0, 1.0)?;
+        tetgen
+            .set_facet_point(0, 0, 0)?
+            .set_facet_point(0, 1, 2)?
+            .set_facet_point(0, 2, 1)?;
+        tetgen
+            .set_facet_point(1, 0, 0)?
+            .set_facet_point(1, 1, 1)?
+            .set_facet_point(1, 2, 3)?;
+        tetgen
+            .set_facet_point(2, 0, 0)?
+            .set_facet_point(2, 1, 3)?
+            .set_facet_point(2, 2, 2)?;
+        tetgen
+            .set_facet_point(3, 0, 1)?
+            .set_facet_point(3, 1, 2)?
+            .set_facet_point(3, 2, 3)?;
+        tetgen.generate_mesh(false, false, Some(0.1), None)?;
+
+        // cannot write before a run
+        let empty = Tetgen::new(4, None, None, None)?;
+        assert_eq!(
+            empty.write_snapshot("/tmp/tritet/tetgen_snapshot_empty.bin").err(),
+            Some("there are no tetrahedra to write")
+        );
+
+        // write, read back into a fresh instance, and compare everything
+        std::fs::create_dir_all("/tmp/tritet").map_err(|_| "cannot create directory")?;
+        let path = "/tmp/tritet/tetgen_snapshot_roundtrip.bin";
+        tetgen.write_snapshot(path)?;
+        let mut restored = Tetgen::new(4, None, None, None)?;
+        restored.read_snapshot(path)?;
+        let npoint = tetgen.out_npoint();
+        let ncell = tetgen.out_ncell();
+        assert_eq!(restored.out_npoint(), npoint);
+        assert_eq!(restored.out_ncell(), ncell);
+        assert_eq!(restored.out_cell_npoint(), tetgen.out_cell_npoint());
+        for p in 0..npoint {
+            for dim in 0..3 {
+                assert_eq!(restored.out_point(p, dim), tetgen.out_point(p, dim));
+            }
+            assert_eq!(restored.out_point_marker(p), tetgen.out_point_marker(p));
+        }
+        for t in 0..ncell {
+            for m in 0..4 {
+                assert_eq!(restored.out_cell_point(t, m), tetgen.out_cell_point(t, m));
+            }
+            for side in 0..4 {
+                assert_eq!(restored.out_cell_neighbor(t, side), tetgen.out_cell_neighbor(t, side));
+            }
+        }
+        assert_eq!(restored.out_marked_faces(), tetgen.out_marked_faces());
+
+        // the restored mesh can be refined like a freshly generated one
+        restored.refine_mesh(false, None, Some(1.5))?;
+        assert!(restored.out_ncell() >= ncell);
+
+        // garbage is rejected
+        std::fs::write("/tmp/tritet/tetgen_snapshot_bad.bin", b"not a snapshot").map_err(|_| "cannot write file")?;
+        assert_eq!(
+            restored.read_snapshot("/tmp/tritet/tetgen_snapshot_bad.bin").err(),
+            Some("the snapshot file is invalid or corrupted")
+        );
+        assert_eq!(
+            restored.read_snapshot("/tmp/tritet/tetgen_snapshot_missing.bin").err(),
+            Some("cannot read or write the snapshot file")
+        );
+
+        // a corrupted count (here n_marked_face, at byte 40 of the header) and a
+        // truncated file are rejected before any allocation happens
+        let bytes = std::fs::read(path).map_err(|_| "cannot read file")?;
+        let mut corrupted = bytes.clone();
+        corrupted[40..48].copy_from_slice(&i64::MAX.to_ne_bytes());
+        std::fs::write("/tmp/tritet/tetgen_snapshot_huge.bin", &corrupted).map_err(|_| "cannot write file")?;
+        assert_eq!(
+            restored.read_snapshot("/tmp/tritet/tetgen_snapshot_huge.bin").err(),
+            Some("the snapshot file is invalid or corrupted")
+        );
+        let truncated = &bytes[..bytes.len() - 8];
+        std::fs::write("/tmp/tritet/tetgen_snapshot_truncated.bin", truncated).map_err(|_| "cannot write file")?;
+        assert_eq!(
+            restored
+                .read_snapshot("/tmp/tritet/tetgen_snapshot_truncated.bin")
+                .err(),
+            Some("the snapshot file is invalid or corrupted")
+        );
+
+        // the single-precision variant narrows the coordinates but keeps everything else
+        let path_f32 = "/tmp/tritet/tetgen_snapshot_roundtrip_f32.bin";
+        tetgen.write_snapshot_with(path_f32, true)?;
+        let size_f64 = std::fs::metadata(path).map_err(|_| "cannot stat file")?.len();
+        let size_f32 = std::fs::metadata(path_f32).map_err(|_| "cannot stat file")?.len();
+        assert_eq!(size_f64 - size_f32, (npoint * 3 * 4) as u64);
+        let mut narrowed = Tetgen::new(4, None, None, None)?;
+        narrowed.read_snapshot(path_f32)?;
+        assert_eq!(narrowed.out_npoint(), npoint);
+        assert_eq!(narrowed.out_ncell(), ncell);
+        for p in 0..npoint {
+            for dim in 0..3 {
+                assert_eq!(narrowed.out_point(p, dim), tetgen.out_point(p, dim) as f32 as f64);
+            }
+        }
+        for t in 0..ncell {
+            for m in 0..4 {
+                assert_eq!(narrowed.out_cell_point(t, m), tetgen.out_cell_point(t, m));
+            }
+        }
         Ok(())
     }
 
@@ -1312,7 +3249,7 @@ mod tests {
         tetgen.set_point(2, 0, 1.0, 0.0, 0.0)?; // z=0
         tetgen.set_point(3, 0, 0.0, 1.0, 0.0)?; // z=0, thus, all points are coplanar
         assert_eq!(
-            tetgen.generate_delaunay(false).err(),
+            tetgen.generate_delaunay(false, true).err(),
             Some("TetGen failed: points are probably coplanar")
         );
         Ok(())
@@ -1,11 +1,12 @@
 use crate::constants;
 use crate::constants::VTK_TRIANGLE;
+use crate::conversion::to_i32;
 use crate::StrError;
 use crate::Tetgen;
 use std::ffi::OsStr;
 use std::fmt::Write;
 use std::fs::{self, File};
-use std::io::Write as IoWrite;
+use std::io::{BufWriter, Write as IoWrite};
 use std::path::Path;
 
 impl Tetgen {
@@ -187,6 +188,211 @@ impl Tetgen {
         file.sync_all().map_err(|_| "cannot sync file")?;
         Ok(())
     }
+
+    /// Writes a binary VTU file to visualize the mesh with Paraview
+    ///
+    /// This works like [Tetgen::write_vtu] but stores the data as raw appended
+    /// blocks (VTK's `format="appended"` with `encoding="raw"`) and streams them
+    /// through a [BufWriter] -- no float formatting and no in-memory copy of the
+    /// file, which matters for large meshes.
+    ///
+    /// # Input
+    ///
+    /// * `full_path` -- may be a String, &str, or Path
+    pub fn write_vtu_binary<P>(&self, full_path: &P) -> Result<(), StrError>
+    where
+        P: AsRef<OsStr> + ?Sized,
+    {
+        self.write_vtu_binary_with(full_path, false)
+    }
+
+    /// Writes a binary VTU file with optionally narrowed (f32) coordinates
+    ///
+    /// This works like [Tetgen::write_vtu_binary] but, with `single_precision`, narrows
+    /// the coordinates to f32 during the streaming write (Paraview ingests either
+    /// width). The coordinates block then takes half the bytes, which adds up quickly
+    /// when writing one file per frame of an animation; the connectivity and the
+    /// markers are unaffected.
+    ///
+    /// # Input
+    ///
+    /// * `full_path` -- may be a String, &str, or Path
+    /// * `single_precision` -- writes the coordinates as f32 instead of f64
+    pub fn write_vtu_binary_with<P>(&self, full_path: &P, single_precision: bool) -> Result<(), StrError>
+    where
+        P: AsRef<OsStr> + ?Sized,
+    {
+        let ntet = self.out_ncell();
+        if ntet < 1 {
+            return Err("there are no tetrahedra to write");
+        }
+
+        let n_marked_faces = self.out_n_marked_face();
+        let ncell = ntet + n_marked_faces;
+
+        let npoint = self.out_npoint();
+        let nnode = self.out_cell_npoint();
+        let vtk_type = if nnode == 4 {
+            constants::VTK_TETRA
+        } else {
+            constants::VTK_QUADRATIC_TETRA
+        };
+
+        let (face_points, face_markers, _) = self.out_marked_faces();
+        let n_face_point = if nnode == 4 { 3 } else { 6 };
+
+        // the appended blocks: each one is a UInt64 byte count followed by raw
+        // little-endian data; the offsets can thus be computed upfront
+        const LEN: u64 = 8; // size of the UInt64 byte count
+        let (float_type, float_width) = if single_precision {
+            ("Float32", 4)
+        } else {
+            ("Float64", 8)
+        };
+        let size_coords = (npoint * 3 * float_width) as u64;
+        let size_connectivity = ((ntet * nnode + n_marked_faces * n_face_point) * 4) as u64;
+        let size_offsets = (ncell * 4) as u64;
+        let size_types = ncell as u64;
+        let size_markers = (npoint * 4) as u64;
+        let size_attributes = (ncell * 4) as u64;
+        let offset_coords: u64 = 0;
+        let offset_connectivity = offset_coords + LEN + size_coords;
+        let offset_offsets = offset_connectivity + LEN + size_connectivity;
+        let offset_types = offset_offsets + LEN + size_offsets;
+        let offset_markers = offset_types + LEN + size_types;
+        let offset_attributes = offset_markers + LEN + size_markers;
+
+        // create directory
+        let path = Path::new(full_path);
+        if let Some(p) = path.parent() {
+            fs::create_dir_all(p).map_err(|_| "cannot create directory")?;
+        }
+
+        // write file (streaming)
+        let file = File::create(path).map_err(|_| "cannot create file")?;
+        let mut w = BufWriter::new(file);
+        let e = |_| "cannot write file";
+
+        // header
+        write!(
+            &mut w,
+            "<?xml version=\"1.0\"?>\n\
+         <VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\"LittleEndian\" header_type=\"UInt64\">\n\
+         <UnstructuredGrid>\n\
+         <Piece NumberOfPoints=\"{}\" NumberOfCells=\"{}\">\n\
+         <Points>\n\
+         <DataArray type=\"{}\" NumberOfComponents=\"3\" format=\"appended\" offset=\"{}\"/>\n\
+         </Points>\n\
+         <Cells>\n\
+         <DataArray type=\"Int32\" Name=\"connectivity\" format=\"appended\" offset=\"{}\"/>\n\
+         <DataArray type=\"Int32\" Name=\"offsets\" format=\"appended\" offset=\"{}\"/>\n\
+         <DataArray type=\"UInt8\" Name=\"types\" format=\"appended\" offset=\"{}\"/>\n\
+         </Cells>\n\
+         <PointData Scalars=\"TheScalars\">\n\
+         <DataArray type=\"Int32\" Name=\"marker\" NumberOfComponents=\"1\" format=\"appended\" offset=\"{}\"/>\n\
+         </PointData>\n\
+         <CellData Scalars=\"TheScalars\">\n\
+         <DataArray type=\"Int32\" Name=\"attribute\" NumberOfComponents=\"1\" format=\"appended\" offset=\"{}\"/>\n\
+         </CellData>\n\
+         </Piece>\n\
+         </UnstructuredGrid>\n\
+         <AppendedData encoding=\"raw\">\n_",
+            npoint,
+            ncell,
+            float_type,
+            offset_coords,
+            offset_connectivity,
+            offset_offsets,
+            offset_types,
+            offset_markers,
+            offset_attributes
+        )
+        .map_err(e)?;
+
+        // nodes: coordinates (narrowed to f32 on the fly when requested)
+        w.write_all(&size_coords.to_le_bytes()).map_err(e)?;
+        for index in 0..npoint {
+            for dim in 0..3 {
+                let value = self.out_point(index, dim);
+                if single_precision {
+                    w.write_all(&(value as f32).to_le_bytes()).map_err(e)?;
+                } else {
+                    w.write_all(&value.to_le_bytes()).map_err(e)?;
+                }
+            }
+        }
+
+        // elements: connectivity (chunked visits overlap the writing with the extraction)
+        w.write_all(&size_connectivity.to_le_bytes()).map_err(e)?;
+        let mut io_failed = false;
+        self.out_visit_cells(16 * 1024, |_, chunk| {
+            for cell in chunk.chunks_exact(nnode) {
+                for m in 0..nnode {
+                    // map TetGen's corner order to tritet's (VTK-compatible) order
+                    if w.write_all(&cell[constants::TRITET_TO_TETGEN[m]].to_le_bytes())
+                        .is_err()
+                    {
+                        io_failed = true;
+                        return false;
+                    }
+                }
+            }
+            true
+        })?;
+        if io_failed {
+            return Err("cannot write file");
+        }
+        for index in 0..n_marked_faces {
+            for m in 0..n_face_point {
+                w.write_all(&face_points[index * 6 + m].to_le_bytes()).map_err(e)?;
+            }
+        }
+
+        // elements: offsets
+        w.write_all(&size_offsets.to_le_bytes()).map_err(e)?;
+        let mut offset = 0;
+        for _ in 0..ntet {
+            offset += nnode;
+            w.write_all(&to_i32(offset).to_le_bytes()).map_err(e)?;
+        }
+        for _ in 0..n_marked_faces {
+            offset += n_face_point;
+            w.write_all(&to_i32(offset).to_le_bytes()).map_err(e)?;
+        }
+
+        // elements: types
+        w.write_all(&size_types.to_le_bytes()).map_err(e)?;
+        for _ in 0..ntet {
+            w.write_all(&[vtk_type as u8]).map_err(e)?;
+        }
+        for _ in 0..n_marked_faces {
+            w.write_all(&[VTK_TRIANGLE as u8]).map_err(e)?;
+        }
+
+        // data -- points
+        w.write_all(&size_markers.to_le_bytes()).map_err(e)?;
+        for index in 0..npoint {
+            w.write_all(&self.out_point_marker(index).to_le_bytes()).map_err(e)?;
+        }
+
+        // data -- cells
+        w.write_all(&size_attributes.to_le_bytes()).map_err(e)?;
+        for index in 0..ntet {
+            w.write_all(&to_i32(self.out_cell_attribute(index)).to_le_bytes())
+                .map_err(e)?;
+        }
+        for index in 0..n_marked_faces {
+            w.write_all(&face_markers[index].to_le_bytes()).map_err(e)?;
+        }
+
+        // close AppendedData
+        write!(&mut w, "\n</AppendedData>\n</VTKFile>\n").map_err(e)?;
+
+        // force sync
+        let file = w.into_inner().map_err(|_| "cannot write file")?;
+        file.sync_all().map_err(|_| "cannot sync file")?;
+        Ok(())
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -205,7 +411,7 @@ mod tests {
             .set_point(1, -2, 1.0, 0.0, 0.0)?
             .set_point(2, -3, 0.0, 1.0, 0.0)?
             .set_point(3, -4, 0.0, 0.0, 1.0)?;
-        tetgen.generate_delaunay(false)?;
+        tetgen.generate_delaunay(false, true)?;
         let file_path = "/tmp/tritet/test_tetgen_write_vtu_1.vtu";
         tetgen.write_vtu(file_path)?;
         let contents = fs::read_to_string(file_path).map_err(|_| "cannot open file")?;
@@ -249,6 +455,86 @@ mod tests {
         Ok(())
     }
 
+    #[test]
+    fn tetgen_write_vtu_binary() -> Result<(), StrError> {
+        let mut tetgen = Tetgen::new(4, None, None, None)?;
+        tetgen
+            .set_point(0, -1, 0.0, 0.0, 0.0)?
+            .set_point(1, -2, 1.0, 0.0, 0.0)?
+            .set_point(2, -3, 0.0, 1.0, 0.0)?
+            .set_point(3, -4, 0.0, 0.0, 1.0)?;
+        tetgen.generate_delaunay(false, true)?;
+        let file_path = "/tmp/tritet/test_tetgen_write_vtu_binary.vtu";
+        tetgen.write_vtu_binary(file_path)?;
+        let contents = fs::read(file_path).map_err(|_| "cannot open file")?;
+
+        // the header references appended blocks
+        let header = String::from_utf8_lossy(&contents[..contents.len().min(2048)]).to_string();
+        assert!(header.contains("header_type=\"UInt64\""));
+        assert!(
+            header.contains("<DataArray type=\"Float64\" NumberOfComponents=\"3\" format=\"appended\" offset=\"0\"/>")
+        );
+
+        // decode the coordinates block (UInt64 byte count + raw little-endian f64)
+        let marker = b"<AppendedData encoding=\"raw\">\n_";
+        let start = contents
+            .windows(marker.len())
+            .position(|w| w == marker)
+            .ok_or("cannot find appended data")?
+            + marker.len();
+        let nbyte = u64::from_le_bytes(contents[start..start + 8].try_into().unwrap()) as usize;
+        assert_eq!(nbyte, 4 * 3 * 8);
+        let mut coords = vec![0.0_f64; 12];
+        for i in 0..12 {
+            let a = start + 8 + i * 8;
+            coords[i] = f64::from_le_bytes(contents[a..a + 8].try_into().unwrap());
+        }
+        for p in 0..4 {
+            for dim in 0..3 {
+                assert_eq!(coords[p * 3 + dim], tetgen.out_point(p, dim));
+            }
+        }
+        Ok(())
+    }
+
+    #[test]
+    fn tetgen_write_vtu_binary_f32() -> Result<(), StrError> {
+        let mut tetgen = Tetgen::new(4, None, None, None)?;
+        tetgen
+            .set_point(0, -1, 0.0, 0.0, 0.0)?
+            .set_point(1, -2, 1.0, 0.0, 0.0)?
+            .set_point(2, -3, 0.0, 1.0, 0.0)?
+            .set_point(3, -4, 0.0, 0.0, 1.0)?;
+        tetgen.generate_delaunay(false, true)?;
+        let file_path = "/tmp/tritet/test_tetgen_write_vtu_binary_f32.vtu";
+        tetgen.write_vtu_binary_with(file_path, true)?;
+        let contents = fs::read(file_path).map_err(|_| "cannot open file")?;
+
+        // the header references an f32 coordinates block
+        let header = String::from_utf8_lossy(&contents[..contents.len().min(2048)]).to_string();
+        assert!(
+            header.contains("<DataArray type=\"Float32\" NumberOfComponents=\"3\" format=\"appended\" offset=\"0\"/>")
+        );
+
+        // decode the coordinates block (UInt64 byte count + raw little-endian f32)
+        let marker = b"<AppendedData encoding=\"raw\">\n_";
+        let start = contents
+            .windows(marker.len())
+            .position(|w| w == marker)
+            .ok_or("cannot find appended data")?
+            + marker.len();
+        let nbyte = u64::from_le_bytes(contents[start..start + 8].try_into().unwrap()) as usize;
+        assert_eq!(nbyte, 4 * 3 * 4);
+        for p in 0..4 {
+            for dim in 0..3 {
+                let a = start + 8 + (p * 3 + dim) * 4;
+                let value = f32::from_le_bytes(contents[a..a + 4].try_into().unwrap());
+                assert_eq!(value, tetgen.out_point(p, dim) as f32);
+            }
+        }
+        Ok(())
+    }
+
     #[test]
     fn tetgen_write_vtu_2() -> Result<(), StrError> {
         let mut tetgen = Tetgen::new(8, Some(vec![4, 4, 4, 4, 4, 4]), Some(1), None)?;
@@ -1,4 +1,4 @@
-use crate::constants::{handle_status, TRITET_TO_TRIANGLE,LIGHT_COLORS};
+use crate::constants::{handle_status, LIGHT_COLORS, TRITET_TO_TRIANGLE};
 use crate::conversion::to_i32;
 use crate::StrError;
 use plotpy::{Canvas, Curve, Plot, PolyCode, Text};
@@ -14,11 +14,14 @@ extern "C" {
     fn tri_new_trigen(npoint: i32, nsegment: i32, nregion: i32, nhole: i32) -> *mut ExtTrigen;
     fn tri_drop_trigen(trigen: *mut ExtTrigen);
     fn tri_set_point(trigen: *mut ExtTrigen, index: i32, marker: i32, x: f64, y: f64) -> i32;
+    fn tri_set_points_batch(trigen: *mut ExtTrigen, npoint: i32, coords: *const f64, markers: *const i32) -> i32;
+    fn tri_set_segments_batch(trigen: *mut ExtTrigen, nsegment: i32, segments: *const i32, markers: *const i32) -> i32;
     fn tri_set_segment(trigen: *mut ExtTrigen, index: i32, marker: i32, a: i32, b: i32) -> i32;
     fn tri_set_region(trigen: *mut ExtTrigen, index: i32, attribute: i32, x: f64, y: f64, max_area: f64) -> i32;
     fn tri_set_hole(trigen: *mut ExtTrigen, index: i32, x: f64, y: f64) -> i32;
     fn tri_run_delaunay(trigen: *mut ExtTrigen, verbose: i32) -> i32;
     fn tri_run_voronoi(trigen: *mut ExtTrigen, verbose: i32) -> i32;
+    fn tri_voronoi_from_delaunay(trigen: *mut ExtTrigen) -> i32;
     fn tri_run_triangulate(
         trigen: *mut ExtTrigen,
         verbose: i32,
@@ -27,6 +30,35 @@ extern "C" {
         global_max_area: f64,
         global_min_angle: f64,
     ) -> i32;
+    fn tri_insert_points(trigen: *mut ExtTrigen, n: i32, coords: *const f64) -> i32;
+    fn tri_move_points(trigen: *mut ExtTrigen, n: i32, coords: *const f64) -> i32;
+    fn tri_adopt_output_as_input(trigen: *mut ExtTrigen) -> i32;
+    fn tri_out_quality_histogram(
+        trigen: *mut ExtTrigen,
+        nbin: i32,
+        histogram: *mut i64,
+        min_quality: *mut f64,
+        max_quality: *mut f64,
+    ) -> i32;
+    fn tri_out_worst_cells(
+        trigen: *mut ExtTrigen,
+        nworst: i32,
+        cells: *mut i32,
+        qualities: *mut f64,
+        count: *mut i32,
+    ) -> i32;
+    fn tri_set_output_mesh(
+        trigen: *mut ExtTrigen,
+        npoint: i32,
+        coords: *const f64,
+        point_markers: *const i32,
+        ntriangle: i32,
+        triangles: *const i32,
+        attributes: *const i32,
+        nsegment: i32,
+        segments: *const i32,
+        segment_markers: *const i32,
+    ) -> i32;
     fn tri_out_npoint(trigen: *mut ExtTrigen) -> i32;
     fn tri_out_nsegment(trigen: *mut ExtTrigen) -> i32;
     fn tri_out_ncell(trigen: *mut ExtTrigen) -> i32;
@@ -37,11 +69,64 @@ extern "C" {
     fn tri_out_segment_marker(trigen: *mut ExtTrigen, index: i32) -> i32;
     fn tri_out_cell_point(trigen: *mut ExtTrigen, index: i32, corner: i32) -> i32;
     fn tri_out_cell_attribute(trigen: *mut ExtTrigen, index: i32) -> i32;
+    fn tri_out_cell_neighbor(trigen: *mut ExtTrigen, index: i32, side: i32) -> i32;
+    fn tri_out_neighbor_list(trigen: *mut ExtTrigen) -> *const i32;
+    fn tri_out_nedge(trigen: *mut ExtTrigen) -> i32;
+    fn tri_out_edge_point(trigen: *mut ExtTrigen, index: i32, side: i32) -> i32;
+    fn tri_out_edge_marker(trigen: *mut ExtTrigen, index: i32) -> i32;
+    fn tri_out_edge_list(trigen: *mut ExtTrigen) -> *const i32;
+    fn tri_out_edge_marker_list(trigen: *mut ExtTrigen) -> *const i32;
+    fn tri_out_point_list(trigen: *mut ExtTrigen) -> *const f64;
+    fn tri_out_point_marker_list(trigen: *mut ExtTrigen) -> *const i32;
+    fn tri_out_segment_list(trigen: *mut ExtTrigen) -> *const i32;
+    fn tri_out_segment_marker_list(trigen: *mut ExtTrigen) -> *const i32;
+    fn tri_out_cell_point_list(trigen: *mut ExtTrigen) -> *const i32;
     fn tri_out_voronoi_npoint(trigen: *mut ExtTrigen) -> i32;
     fn tri_out_voronoi_point(trigen: *mut ExtTrigen, index: i32, dim: i32) -> f64;
     fn tri_out_voronoi_nedge(trigen: *mut ExtTrigen) -> i32;
     fn tri_out_voronoi_edge_point(trigen: *mut ExtTrigen, index: i32, side: i32) -> i32;
     fn tri_out_voronoi_edge_point_b_direction(trigen: *mut ExtTrigen, index: i32, dim: i32) -> f64;
+    fn tri_out_voronoi_edge_split(
+        trigen: *mut ExtTrigen,
+        finite_edges: *mut *const i32,
+        n_finite: *mut i32,
+        infinite_edges: *mut *const i32,
+        n_infinite: *mut i32,
+    ) -> i32;
+    fn tri_out_voronoi_edge_list(trigen: *mut ExtTrigen) -> *const i32;
+    fn tri_out_voronoi_direction_list(trigen: *mut ExtTrigen) -> *const f64;
+    fn tri_out_pool_stats(trigen: *mut ExtTrigen, stats: *mut TriPoolStats);
+}
+
+/// Holds memory pool usage captured by the last run
+///
+/// Triangle's memory pools manage all element storage; this struct exposes their live
+/// item counts and high-water marks, so container memory limits can be sized from the
+/// observed peaks instead of trial and error. All fields are zero before the first run.
+/// See [Trigen::pool_stats].
+#[repr(C)]
+#[derive(Clone, Copy, Debug, Default, PartialEq)]
+pub struct TriPoolStats {
+    /// Number of live items of the vertex pool at the end of the run
+    pub vertices_items: i64,
+
+    /// High-water mark of the vertex pool
+    pub vertices_max_items: i64,
+
+    /// Number of live items of the triangle pool
+    pub triangles_items: i64,
+
+    /// High-water mark of the triangle pool
+    pub triangles_max_items: i64,
+
+    /// Number of live items of the subsegment pool
+    pub subsegs_items: i64,
+
+    /// High-water mark of the subsegment pool
+    pub subsegs_max_items: i64,
+
+    /// Approximate peak heap use of all pools (bytes)
+    pub pool_peak_bytes: i64,
 }
 
 /// Holds the index of an endpoint on a Voronoi edge or the direction of the Voronoi edge
@@ -263,6 +348,11 @@ pub struct Trigen {
     all_holes_set: bool,        // indicates that all holes have been set
 }
 
+// SAFETY: the c-code keeps all of its state in ExtTrigen (owned exclusively by this
+// struct) and in thread-local or constant globals, thus instances may be moved to
+// (and run from) other threads
+unsafe impl Send for Trigen {}
+
 impl Drop for Trigen {
     /// Tells the c-code to release memory
     fn drop(&mut self) {
@@ -357,6 +447,60 @@ impl Trigen {
         Ok(self)
     }
 
+    /// Sets all point coordinates and markers at once
+    ///
+    /// This function hands the whole arrays across the FFI boundary in a single call;
+    /// thus, it is much faster than calling [Trigen::set_point] in a loop when loading
+    /// large point clouds.
+    ///
+    /// # Input
+    ///
+    /// * `coords` -- (len = 2 × `npoint`) the coordinates organized as `[x0, y0, x1, y1, ...]`
+    /// * `markers` -- (len = `npoint`) the markers of the points (see [Trigen::set_point])
+    pub fn set_points_batch(&mut self, coords: &[f64], markers: &[i32]) -> Result<&mut Self, StrError> {
+        if coords.len() != self.npoint * 2 {
+            return Err("coords.len() must be equal to 2 · npoint");
+        }
+        if markers.len() != self.npoint {
+            return Err("markers.len() must be equal to npoint");
+        }
+        unsafe {
+            let status = tri_set_points_batch(self.ext_trigen, to_i32(self.npoint), coords.as_ptr(), markers.as_ptr());
+            handle_status(status)?;
+        }
+        self.all_points_set = true;
+        Ok(self)
+    }
+
+    /// Sets all segment endpoint IDs and markers at once
+    ///
+    /// This function hands the whole arrays across the FFI boundary in a single call,
+    /// with the endpoint IDs validated in a single loop on the C side; thus, it is much
+    /// faster than calling [Trigen::set_segment] in a loop for large PSLGs.
+    ///
+    /// # Input
+    ///
+    /// * `segments` -- (len = 2 × `nsegment`) the endpoint IDs organized as `[a0, b0, a1, b1, ...]`
+    /// * `markers` -- (len = `nsegment`) the markers of the segments (see [Trigen::set_segment])
+    pub fn set_segments_batch(&mut self, segments: &[i32], markers: &[i32]) -> Result<&mut Self, StrError> {
+        let nsegment = match self.nsegment {
+            Some(n) => n,
+            None => return Err("cannot set segment because the number of segments is None"),
+        };
+        if segments.len() != nsegment * 2 {
+            return Err("segments.len() must be equal to 2 · nsegment");
+        }
+        if markers.len() != nsegment {
+            return Err("markers.len() must be equal to nsegment");
+        }
+        unsafe {
+            let status = tri_set_segments_batch(self.ext_trigen, to_i32(nsegment), segments.as_ptr(), markers.as_ptr());
+            handle_status(status)?;
+        }
+        self.all_segments_set = true;
+        Ok(self)
+    }
+
     /// Sets the segment endpoint IDs
     ///
     /// # Input
@@ -453,10 +597,14 @@ impl Trigen {
 
     /// Generates a Delaunay triangulation
     ///
+    /// This method may be called repeatedly (e.g., after updating the coordinates with
+    /// [Trigen::set_points_batch]); the output arrays grown by a previous run are
+    /// recycled instead of being reallocated.
+    ///
     /// # Input
     ///
     /// * `verbose` -- Prints Triangle's messages to the console
-    pub fn generate_delaunay(&self, verbose: bool) -> Result<(), StrError> {
+    pub fn generate_delaunay(&mut self, verbose: bool) -> Result<(), StrError> {
         if !self.all_points_set {
             return Err("cannot generate Delaunay triangulation because not all points are set");
         }
@@ -469,10 +617,13 @@ impl Trigen {
 
     /// Generates a Voronoi tessellation and Delaunay triangulation
     ///
+    /// This method may be called repeatedly; the output arrays grown by a previous run
+    /// are recycled instead of being reallocated.
+    ///
     /// # Input
     ///
     /// * `verbose` -- Prints Triangle's messages to the console
-    pub fn generate_voronoi(&self, verbose: bool) -> Result<(), StrError> {
+    pub fn generate_voronoi(&mut self, verbose: bool) -> Result<(), StrError> {
         if !self.all_points_set {
             return Err("cannot generate Voronoi tessellation because not all points are set");
         }
@@ -483,8 +634,26 @@ impl Trigen {
         Ok(())
     }
 
+    /// Computes the Voronoi tessellation from the existing Delaunay triangulation
+    ///
+    /// This derives the circumcenters and the dual edges directly from the output of
+    /// [Trigen::generate_delaunay] (or [Trigen::insert_points]), instead of re-running
+    /// the whole triangulation as [Trigen::generate_voronoi] does. Use it when both
+    /// structures are needed for the same set of points.
+    pub fn voronoi_from_delaunay(&mut self) -> Result<(), StrError> {
+        unsafe {
+            let status = tri_voronoi_from_delaunay(self.ext_trigen);
+            handle_status(status)?;
+        }
+        Ok(())
+    }
+
     /// Generates a conforming constrained Delaunay triangulation with some quality constraints
     ///
+    /// This method may be called repeatedly (e.g., with different constraints); the output
+    /// arrays of a previous run are released first because the size of a quality mesh
+    /// cannot be bounded beforehand.
+    ///
     /// # Input
     ///
     /// * `verbose` -- Prints Triangle's messages to the console
@@ -493,7 +662,7 @@ impl Trigen {
     /// * `global_max_area` -- The maximum area constraint for all generated triangles
     /// * `global_min_angle` -- The minimum angle constraint is given in degrees (the default minimum angle is twenty degrees)
     pub fn generate_mesh(
-        &self,
+        &mut self,
         verbose: bool,
         quadratic: bool,
         allow_new_points_on_bry: bool,
@@ -528,6 +697,285 @@ impl Trigen {
         Ok(())
     }
 
+    /// Inserts points into an existing Delaunay triangulation
+    ///
+    /// This warm-starts from the output of [Trigen::generate_delaunay] and inserts the new
+    /// points locally (Bowyer-Watson), avoiding the full re-triangulation of `O(n log n)`
+    /// for a few points added to a large mesh.
+    ///
+    /// # Input
+    ///
+    /// * `coords` -- The coordinates of the new points as `[x0, y0, x1, y1, ...]`
+    ///
+    /// # Warning
+    ///
+    /// The points must fall inside the convex hull of the existing triangulation and must
+    /// not coincide with existing points. The inserted points are not added to the input
+    /// PSLG; they only grow the output triangulation.
+    pub fn insert_points(&mut self, coords: &[f64]) -> Result<(), StrError> {
+        if coords.len() < 2 || coords.len() % 2 != 0 {
+            return Err("coords.len() must be a positive multiple of 2");
+        }
+        let n = to_i32(coords.len() / 2);
+        unsafe {
+            let status = tri_insert_points(self.ext_trigen, n, coords.as_ptr());
+            handle_status(status)?;
+        }
+        Ok(())
+    }
+
+    /// Moves the existing vertex set to updated coordinates
+    ///
+    /// This warm-starts from the previous output triangulation and restores Delaunayhood
+    /// with local (Lawson) edge flips only, which suits Lagrangian time stepping: between
+    /// solver steps the points move slightly and the connectivity barely changes, so the
+    /// typical step touches a few percent of the triangles instead of paying a full
+    /// re-triangulation. Constrained segment edges are never flipped.
+    ///
+    /// # Input
+    ///
+    /// * `coords` -- The updated coordinates of ALL output points as `[x0, y0, x1, y1, ...]`
+    ///   (thus `coords.len()` must equal twice [Trigen::out_npoint])
+    ///
+    /// # Warning
+    ///
+    /// If a triangle collapses or inverts at the new positions, the displacement is too
+    /// large for local repair: the call fails without changing the output and a full
+    /// re-triangulation is needed.
+    pub fn move_points(&mut self, coords: &[f64]) -> Result<(), StrError> {
+        if coords.len() < 2 || coords.len() % 2 != 0 {
+            return Err("coords.len() must be a positive multiple of 2");
+        }
+        let n = to_i32(coords.len() / 2);
+        unsafe {
+            let status = tri_move_points(self.ext_trigen, n, coords.as_ptr());
+            handle_status(status)?;
+        }
+        Ok(())
+    }
+
+    /// Moves the output of the previous run into the input (pointer-wise, zero copies)
+    ///
+    /// Multi-stage pipelines (e.g., mesh, then re-triangulate the refined point set) can
+    /// thus chain entirely inside the C layer, instead of reading every array out through
+    /// the `out_*` accessors and pushing it back in through the `set_*` methods.
+    ///
+    /// # Warning
+    ///
+    /// The previous input is released, including the region and hole definitions; thus
+    /// [Trigen::set_region] and [Trigen::set_hole] fail after this call. The output
+    /// becomes empty until the next run.
+    pub fn adopt_output_as_input(&mut self) -> Result<(), StrError> {
+        unsafe {
+            let status = tri_adopt_output_as_input(self.ext_trigen);
+            handle_status(status)?;
+        }
+        Ok(())
+    }
+
+    /// Generates a conforming constrained Delaunay triangulation using several threads
+    ///
+    /// The PSLG is first triangulated without an area constraint. The resulting coarse
+    /// triangles are then refined concurrently (one sub-mesh per coarse triangle, distributed
+    /// over `nthread` workers) and stitched back into a single conforming mesh. The sub-meshes
+    /// conform to each other because the coarse edges are subdivided deterministically
+    /// beforehand and the workers are prohibited from inserting points on their boundaries.
+    ///
+    /// # Input
+    ///
+    /// * `verbose` -- Prints Triangle's messages to the console (coarse pass only)
+    /// * `global_max_area` -- The maximum area constraint for all generated triangles
+    /// * `global_min_angle` -- The minimum angle constraint is given in degrees (the default minimum angle is twenty degrees)
+    /// * `nthread` -- The number of worker threads (must be ≥ 1)
+    ///
+    /// # Warning
+    ///
+    /// Only linear triangles are generated and each refined triangle inherits the regional
+    /// attribute of its coarse triangle.
+    pub fn generate_mesh_parallel(
+        &mut self,
+        verbose: bool,
+        global_max_area: Option<f64>,
+        global_min_angle: Option<f64>,
+        nthread: usize,
+    ) -> Result<(), StrError> {
+        if nthread < 1 {
+            return Err("nthread must be at least 1");
+        }
+
+        // coarse pass (this also handles the case without an area constraint)
+        self.generate_mesh(verbose, false, true, None, global_min_angle)?;
+        let max_area = match global_max_area {
+            Some(v) => v,
+            None => return Ok(()),
+        };
+        if max_area <= 0.0 {
+            return Err("global_max_area must be positive");
+        }
+
+        // snapshot the coarse mesh
+        let coarse_triangles = self.out_cell_points_slice().to_vec();
+        let coarse_segments = self.out_segments_slice().to_vec();
+        let coarse_seg_markers = self.out_segment_markers_slice().to_vec();
+        let ncoarse = coarse_triangles.len() / 3;
+        let coarse_attributes: Vec<i32> = (0..ncoarse).map(|t| self.out_cell_attribute(t) as i32).collect();
+        let mut points = self.out_points_slice().to_vec();
+        let mut markers = self.out_point_markers_slice().to_vec();
+
+        // subdivide the coarse edges deterministically (shared between neighboring triangles)
+        // using the edge length of the equilateral triangle with the target area
+        let target_length = f64::sqrt(4.0 * max_area / f64::sqrt(3.0));
+        let segment_marker_of: HashMap<(i32, i32), i32> = coarse_segments
+            .chunks(2)
+            .zip(&coarse_seg_markers)
+            .map(|(s, m)| ((s[0].min(s[1]), s[0].max(s[1])), *m))
+            .collect();
+        let mut edge_points: HashMap<(i32, i32), Vec<i32>> = HashMap::new();
+        for t in 0..ncoarse {
+            for k in 0..3 {
+                let a = coarse_triangles[t * 3 + k];
+                let b = coarse_triangles[t * 3 + (k + 1) % 3];
+                let key = (a.min(b), a.max(b));
+                if edge_points.contains_key(&key) {
+                    continue;
+                }
+                let (xa, ya) = (points[key.0 as usize * 2], points[key.0 as usize * 2 + 1]);
+                let (xb, yb) = (points[key.1 as usize * 2], points[key.1 as usize * 2 + 1]);
+                let length = f64::sqrt((xb - xa) * (xb - xa) + (yb - ya) * (yb - ya));
+                let ndiv = f64::max(f64::ceil(length / target_length), 1.0) as usize;
+                let marker = *segment_marker_of.get(&key).unwrap_or(&0);
+                let mut interior = Vec::with_capacity(ndiv - 1);
+                for j in 1..ndiv {
+                    let s = (j as f64) / (ndiv as f64);
+                    interior.push((points.len() / 2) as i32);
+                    points.push(xa + s * (xb - xa));
+                    points.push(ya + s * (yb - ya));
+                    markers.push(marker);
+                }
+                edge_points.insert(key, interior);
+            }
+        }
+
+        // refine the coarse triangles concurrently
+        let chunk = (ncoarse + nthread - 1) / nthread;
+        let points_ref = &points;
+        let triangles_ref = &coarse_triangles;
+        let edges_ref = &edge_points;
+        let results: Vec<Vec<(Vec<i32>, Vec<f64>, Vec<i32>)>> = std::thread::scope(|scope| {
+            let mut handles = Vec::new();
+            for w in 0..nthread {
+                let first = w * chunk;
+                let last = usize::min((w + 1) * chunk, ncoarse);
+                handles.push(
+                    scope.spawn(move || -> Result<Vec<(Vec<i32>, Vec<f64>, Vec<i32>)>, StrError> {
+                        let mut local = Vec::new();
+                        for t in first..last {
+                            // assemble the ring of boundary points (global ids) around the coarse triangle
+                            let mut ring: Vec<i32> = Vec::new();
+                            for k in 0..3 {
+                                let a = triangles_ref[t * 3 + k];
+                                let b = triangles_ref[t * 3 + (k + 1) % 3];
+                                ring.push(a);
+                                let interior = &edges_ref[&(a.min(b), a.max(b))];
+                                if a < b {
+                                    ring.extend(interior.iter());
+                                } else {
+                                    ring.extend(interior.iter().rev());
+                                }
+                            }
+                            // refine the sub-domain without touching its boundary (Y switch)
+                            let n = ring.len();
+                            let mut sub = Trigen::new(n, Some(n), None, None)?;
+                            let mut coords = Vec::with_capacity(n * 2);
+                            for g in &ring {
+                                coords.push(points_ref[(*g as usize) * 2]);
+                                coords.push(points_ref[(*g as usize) * 2 + 1]);
+                            }
+                            sub.set_points_batch(&coords, &vec![0; n])?;
+                            let mut segments = Vec::with_capacity(n * 2);
+                            for i in 0..n {
+                                segments.push(i as i32);
+                                segments.push(((i + 1) % n) as i32);
+                            }
+                            sub.set_segments_batch(&segments, &vec![0; n])?;
+                            sub.generate_mesh(false, false, false, Some(max_area), global_min_angle)?;
+                            // the input points come first in the output, in the same order;
+                            // the indices ≥ n correspond to interior Steiner points
+                            let extra = sub.out_points_slice()[n * 2..].to_vec();
+                            let cells = sub.out_cell_points_slice().to_vec();
+                            local.push((ring, extra, cells));
+                        }
+                        Ok(local)
+                    }),
+                );
+            }
+            handles
+                .into_iter()
+                .map(|h| h.join().unwrap())
+                .collect::<Result<Vec<_>, StrError>>()
+        })?;
+
+        // stitch the sub-meshes into one mesh (the boundary points are shared by
+        // construction, thus only the private interior points need new global ids)
+        let mut triangles = Vec::new();
+        let mut attributes = Vec::new();
+        let mut t = 0;
+        for local in results {
+            for (ring, extra, cells) in local {
+                let base = (points.len() / 2) as i32;
+                let n = ring.len() as i32;
+                points.extend(extra.iter());
+                markers.extend(std::iter::repeat(0).take(extra.len() / 2));
+                for c in &cells {
+                    triangles.push(if *c < n { ring[*c as usize] } else { base + (*c - n) });
+                }
+                for _ in 0..cells.len() / 3 {
+                    attributes.push(coarse_attributes[t]);
+                }
+                t += 1;
+            }
+        }
+
+        // subdivide the coarse segments accordingly
+        let mut segments = Vec::new();
+        let mut segment_markers = Vec::new();
+        for (s, m) in coarse_segments.chunks(2).zip(&coarse_seg_markers) {
+            let (a, b) = (s[0], s[1]);
+            let mut chain = vec![a];
+            if let Some(interior) = edge_points.get(&(a.min(b), a.max(b))) {
+                if a < b {
+                    chain.extend(interior.iter());
+                } else {
+                    chain.extend(interior.iter().rev());
+                }
+            }
+            chain.push(b);
+            for pair in chain.windows(2) {
+                segments.push(pair[0]);
+                segments.push(pair[1]);
+                segment_markers.push(*m);
+            }
+        }
+
+        // install the merged mesh into the output data
+        unsafe {
+            let status = tri_set_output_mesh(
+                self.ext_trigen,
+                to_i32(points.len() / 2),
+                points.as_ptr(),
+                markers.as_ptr(),
+                to_i32(triangles.len() / 3),
+                triangles.as_ptr(),
+                attributes.as_ptr(),
+                to_i32(segments.len() / 2),
+                segments.as_ptr(),
+                segment_markers.as_ptr(),
+            );
+            handle_status(status)?;
+        }
+        Ok(())
+    }
+
     /// Returns the number of (output) points of the Delaunay triangulation (constrained or not)
     pub fn out_npoint(&self) -> usize {
         unsafe { tri_out_npoint(self.ext_trigen) as usize }
@@ -662,88 +1110,458 @@ impl Trigen {
         unsafe { tri_out_cell_attribute(self.ext_trigen, to_i32(index)) as usize }
     }
 
-    /// Returns the number of points of the Voronoi tessellation
-    pub fn out_voronoi_npoint(&self) -> usize {
-        unsafe { tri_out_voronoi_npoint(self.ext_trigen) as usize }
+    /// Returns all (output) point coordinates as a borrowed slice
+    ///
+    /// The slice has length `2 * out_npoint` and is organized as `[x0, y0, x1, y1, ...]`;
+    /// i.e., the coordinates of point `i` are at positions `i * 2` and `i * 2 + 1`.
+    ///
+    /// This function performs a single FFI call and borrows the array owned by the C-code
+    /// directly (zero-copy); thus, it is much faster than calling [Trigen::out_point] in a loop.
+    /// The next run may free or reallocate the array, which is why the run methods take
+    /// `&mut self`: the borrow checker rejects holding this slice across them.
+    ///
+    /// **Note:** An empty slice is returned if no triangulation has been generated yet.
+    pub fn out_points_slice(&self) -> &[f64] {
+        unsafe {
+            let ptr = tri_out_point_list(self.ext_trigen);
+            let npoint = tri_out_npoint(self.ext_trigen) as usize;
+            if ptr.is_null() || npoint == 0 {
+                return &[];
+            }
+            std::slice::from_raw_parts(ptr, npoint * 2)
+        }
     }
 
-    /// Returns the x-y coordinates of a point on the Voronoi tessellation
+    /// Returns all (output) point markers as a borrowed slice
+    ///
+    /// The slice has length `out_npoint`. See the notes in [Trigen::out_points_slice]
+    /// regarding the zero-copy borrow and in [Trigen::out_point_marker] regarding
+    /// the meaning of boundary markers.
+    pub fn out_point_markers_slice(&self) -> &[i32] {
+        unsafe {
+            let ptr = tri_out_point_marker_list(self.ext_trigen);
+            let npoint = tri_out_npoint(self.ext_trigen) as usize;
+            if ptr.is_null() || npoint == 0 {
+                return &[];
+            }
+            std::slice::from_raw_parts(ptr, npoint)
+        }
+    }
+
+    /// Returns all (output) segments (point IDs) as a borrowed slice
+    ///
+    /// The slice has length `2 * out_nsegment` and is organized as `[a0, b0, a1, b1, ...]`;
+    /// i.e., the endpoints of segment `i` are at positions `i * 2` and `i * 2 + 1`.
+    /// See the notes in [Trigen::out_points_slice] regarding the zero-copy borrow.
+    ///
+    /// **Note:** This option is only available when calling [Trigen::generate_mesh]
+    pub fn out_segments_slice(&self) -> &[i32] {
+        unsafe {
+            let ptr = tri_out_segment_list(self.ext_trigen);
+            let nsegment = tri_out_nsegment(self.ext_trigen) as usize;
+            if ptr.is_null() || nsegment == 0 {
+                return &[];
+            }
+            std::slice::from_raw_parts(ptr, nsegment * 2)
+        }
+    }
+
+    /// Returns all (output) segment markers as a borrowed slice
+    ///
+    /// The slice has length `out_nsegment`. See the notes in [Trigen::out_points_slice]
+    /// regarding the zero-copy borrow and in [Trigen::out_segment_marker] regarding
+    /// the meaning of boundary markers.
+    pub fn out_segment_markers_slice(&self) -> &[i32] {
+        unsafe {
+            let ptr = tri_out_segment_marker_list(self.ext_trigen);
+            let nsegment = tri_out_nsegment(self.ext_trigen) as usize;
+            if ptr.is_null() || nsegment == 0 {
+                return &[];
+            }
+            std::slice::from_raw_parts(ptr, nsegment)
+        }
+    }
+
+    /// Returns the whole (output) connectivity list as a borrowed slice
+    ///
+    /// The slice has length `out_ncell * out_cell_npoint`; i.e., the points of triangle `i`
+    /// are at positions `i * nnode` to `i * nnode + nnode - 1` where `nnode = out_cell_npoint`.
+    /// See the notes in [Trigen::out_points_slice] regarding the zero-copy borrow.
+    ///
+    /// **Warning:** The corners follow **Triangle's** ordering, not the ordering used by
+    /// this library; use [Trigen::out_cell_point] if the tritet ordering is needed:
+    ///
+    /// ```text
+    /// This library (tritet)      Triangle
+    ///         NODES               CORNERS
+    ///           2                    2
+    ///          / \                  / \
+    ///         /   \                /   \
+    ///        5     4              4     3
+    ///       /       \            /       \
+    ///      /         \          /         \
+    ///     0-----3-----1        0-----5-----1
+    /// ```
+    pub fn out_cell_points_slice(&self) -> &[i32] {
+        unsafe {
+            let ptr = tri_out_cell_point_list(self.ext_trigen);
+            let ncell = tri_out_ncell(self.ext_trigen) as usize;
+            let nnode = tri_out_cell_npoint(self.ext_trigen) as usize;
+            if ptr.is_null() || ncell == 0 {
+                return &[];
+            }
+            std::slice::from_raw_parts(ptr, ncell * nnode)
+        }
+    }
+
+    /// Returns the neighbor of a triangle across one of its sides
+    ///
+    /// Returns `-1` if there is no neighbor (boundary side)
     ///
     /// # Input
     ///
-    /// * `index` -- is the index of the point and goes from 0 to `out_voronoi_npoint`
-    /// * `dim` -- is the space dimension index: 0 or 1
+    /// * `index` -- is the index of the triangle and goes from `0` to `out_ncell`
+    /// * `side` -- is the side index: 0, 1, or 2 (opposite to the respective corner)
     ///
     /// # Warning
     ///
-    /// This function will return 0.0 if `index` or `dim` is out of range.
-    pub fn out_voronoi_point(&self, index: usize, dim: usize) -> f64 {
-        unsafe { tri_out_voronoi_point(self.ext_trigen, to_i32(index), to_i32(dim)) }
+    /// This function is only available after calling [Trigen::generate_mesh]
+    pub fn out_cell_neighbor(&self, index: usize, side: usize) -> i32 {
+        unsafe { tri_out_cell_neighbor(self.ext_trigen, to_i32(index), to_i32(side)) }
     }
 
-    /// Returns the number of edges on the Voronoi tessellation
-    pub fn out_voronoi_nedge(&self) -> usize {
-        unsafe { tri_out_voronoi_nedge(self.ext_trigen) as usize }
+    /// Returns a read-only slice with all triangle neighbors (zero-copy)
+    ///
+    /// The slice has a length equal to `out_ncell` times 3 and contains the indices of the
+    /// neighboring triangles (or `-1` on boundary sides), organized as
+    /// `[n0_of_tri0, n1_of_tri0, n2_of_tri0, n0_of_tri1, ...]`.
+    /// See the notes in [Trigen::out_points_slice] regarding the zero-copy borrow.
+    ///
+    /// # Warning
+    ///
+    /// This function is only available after calling [Trigen::generate_mesh];
+    /// otherwise an empty slice is returned
+    pub fn out_neighbors_slice(&self) -> &[i32] {
+        unsafe {
+            let ptr = tri_out_neighbor_list(self.ext_trigen);
+            let ncell = tri_out_ncell(self.ext_trigen) as usize;
+            if ptr.is_null() || ncell == 0 {
+                return &[];
+            }
+            std::slice::from_raw_parts(ptr, ncell * 3)
+        }
     }
 
-    /// Returns the index of the first endpoint on a Voronoi edge
+    /// Returns the number of unique edges of the generated mesh
+    ///
+    /// # Warning
+    ///
+    /// This function is only available after calling [Trigen::generate_mesh];
+    /// otherwise zero is returned
+    pub fn out_nedge(&self) -> usize {
+        unsafe { tri_out_nedge(self.ext_trigen) as usize }
+    }
+
+    /// Returns the point id of an edge of the generated mesh
     ///
     /// # Input
     ///
-    /// * `index` -- is the index of the edge and goes from 0 to `out_voronoi_nedge`
+    /// * `index` -- is the index of the edge and goes from 0 to `out_nedge`
+    /// * `side` -- is the index of the endpoint: 0 or 1
     ///
     /// # Warning
     ///
-    /// This function will return 0 if `index` is out of range.
-    pub fn out_voronoi_edge_point_a(&self, index: usize) -> usize {
-        unsafe { tri_out_voronoi_edge_point(self.ext_trigen, to_i32(index), 0) as usize }
+    /// This function will return 0 if either `index` or `side` is out of range.
+    pub fn out_edge_point(&self, index: usize, side: usize) -> usize {
+        unsafe { tri_out_edge_point(self.ext_trigen, to_i32(index), to_i32(side)) as usize }
     }
 
-    /// Returns the index of the second endpoint on a Voronoi edge or the direction of the Voronoi edge
+    /// Returns the boundary marker of an edge of the generated mesh
     ///
-    /// # Input
+    /// Edges on the boundary receive the marker of their segment (or 1 by default);
+    /// interior edges receive 0.
     ///
-    /// * `index` -- is the index of the edge and goes from 0 to `out_voronoi_nedge`
+    /// # Warning
+    ///
+    /// This function will return 0 if the `index` is out of range.
+    pub fn out_edge_marker(&self, index: usize) -> i32 {
+        unsafe { tri_out_edge_marker(self.ext_trigen, to_i32(index)) }
+    }
+
+    /// Returns all unique edges of the generated mesh as a borrowed slice
+    ///
+    /// The slice has length `2 * out_nedge` and contains the endpoint ids of each edge,
+    /// organized as `[a0, b0, a1, b1, ...]`. Having Triangle emit this list (the `-e`
+    /// switch) avoids re-deriving the unique edges from the triangle list with a hash
+    /// set. See the notes in [Trigen::out_points_slice] regarding the zero-copy borrow.
     ///
     /// # Warning
     ///
-    /// This function will return Index(0) if `index` is out of range.
-    pub fn out_voronoi_edge_point_b(&self, index: usize) -> VoronoiEdgePoint {
+    /// This function is only available after calling [Trigen::generate_mesh];
+    /// otherwise an empty slice is returned
+    pub fn out_edges_slice(&self) -> &[i32] {
         unsafe {
-            let index_i32 = to_i32(index);
-            let id = tri_out_voronoi_edge_point(self.ext_trigen, index_i32, 1);
-            if id == -1 {
-                let x = tri_out_voronoi_edge_point_b_direction(self.ext_trigen, index_i32, 0);
-                let y = tri_out_voronoi_edge_point_b_direction(self.ext_trigen, index_i32, 1);
-                VoronoiEdgePoint::Direction(x, y)
-            } else {
-                VoronoiEdgePoint::Index(id as usize)
+            let ptr = tri_out_edge_list(self.ext_trigen);
+            let nedge = tri_out_nedge(self.ext_trigen) as usize;
+            if ptr.is_null() || nedge == 0 {
+                return &[];
             }
+            std::slice::from_raw_parts(ptr, nedge * 2)
         }
     }
 
-    /// Draw triangles
-    pub fn draw_triangles(
-        &self,
-        plot: &mut Plot,
-        set_range: bool,
-        with_point_ids: bool,
-        with_triangle_ids: bool,
-        with_attribute_ids: bool,
-        fontsize_point_ids: Option<f64>,
-        fontsize_triangle_ids: Option<f64>,
-        fontsize_attribute_ids: Option<f64>,
-    ) {
-        let n_triangle = self.out_ncell();
-        if n_triangle < 1 {
-            return;
+    /// Returns the boundary markers of all unique edges as a borrowed slice
+    ///
+    /// The slice has length `out_nedge`; boundary conditions can thus be applied in one
+    /// pass over the edges without a separate boundary extraction. See the notes in
+    /// [Trigen::out_edge_marker] regarding the meaning of the markers and in
+    /// [Trigen::out_points_slice] regarding the zero-copy borrow.
+    ///
+    /// # Warning
+    ///
+    /// This function is only available after calling [Trigen::generate_mesh];
+    /// otherwise an empty slice is returned
+    pub fn out_edge_markers_slice(&self) -> &[i32] {
+        unsafe {
+            let ptr = tri_out_edge_marker_list(self.ext_trigen);
+            let nedge = tri_out_nedge(self.ext_trigen) as usize;
+            if ptr.is_null() || nedge == 0 {
+                return &[];
+            }
+            std::slice::from_raw_parts(ptr, nedge)
         }
-        let mut canvas = Canvas::new();
-        let mut point_ids = Text::new();
-        let mut triangle_ids = Text::new();
-        let mut attribute_ids = Text::new();
-        if with_point_ids {
-            point_ids
+    }
+
+    /// Returns the histogram of the per-triangle quality (minimum interior angle)
+    ///
+    /// The quality of a triangle is its minimum interior angle in degrees. The `nbin`
+    /// bins have equal width and span `[0°, 60°)`; larger angles land in the last bin.
+    /// The histogram is computed in one sequential pass inside the C layer, so gating
+    /// a solver on mesh quality does not require re-scanning the mesh element by element.
+    ///
+    /// Returns `(histogram, min_quality, max_quality)` with the exact extremes.
+    ///
+    /// # Warning
+    ///
+    /// This function is only available after calling [Trigen::generate_delaunay]
+    /// or [Trigen::generate_mesh]
+    pub fn out_quality_histogram(&self, nbin: usize) -> Result<(Vec<i64>, f64, f64), StrError> {
+        if nbin < 1 {
+            return Err("nbin must be at least 1");
+        }
+        let mut histogram = vec![0_i64; nbin];
+        let mut min_quality = 0.0;
+        let mut max_quality = 0.0;
+        unsafe {
+            let status = tri_out_quality_histogram(
+                self.ext_trigen,
+                to_i32(nbin),
+                histogram.as_mut_ptr(),
+                &mut min_quality,
+                &mut max_quality,
+            );
+            handle_status(status)?;
+        }
+        Ok((histogram, min_quality, max_quality))
+    }
+
+    /// Returns the (at most) `nworst` cells of smallest quality, sorted worst first
+    ///
+    /// The quality of a triangle is its minimum interior angle in degrees. Each entry
+    /// is `(cell_index, quality)`; fewer than `nworst` entries are returned when the
+    /// mesh has fewer cells. See also [Trigen::out_quality_histogram].
+    ///
+    /// # Warning
+    ///
+    /// This function is only available after calling [Trigen::generate_delaunay]
+    /// or [Trigen::generate_mesh]
+    pub fn out_worst_cells(&self, nworst: usize) -> Result<Vec<(usize, f64)>, StrError> {
+        if nworst < 1 {
+            return Err("nworst must be at least 1");
+        }
+        let mut cells = vec![0_i32; nworst];
+        let mut qualities = vec![0.0_f64; nworst];
+        let mut count = 0_i32;
+        unsafe {
+            let status = tri_out_worst_cells(
+                self.ext_trigen,
+                to_i32(nworst),
+                cells.as_mut_ptr(),
+                qualities.as_mut_ptr(),
+                &mut count,
+            );
+            handle_status(status)?;
+        }
+        Ok((0..count as usize).map(|i| (cells[i] as usize, qualities[i])).collect())
+    }
+
+    /// Returns the number of points of the Voronoi tessellation
+    pub fn out_voronoi_npoint(&self) -> usize {
+        unsafe { tri_out_voronoi_npoint(self.ext_trigen) as usize }
+    }
+
+    /// Returns the x-y coordinates of a point on the Voronoi tessellation
+    ///
+    /// # Input
+    ///
+    /// * `index` -- is the index of the point and goes from 0 to `out_voronoi_npoint`
+    /// * `dim` -- is the space dimension index: 0 or 1
+    ///
+    /// # Warning
+    ///
+    /// This function will return 0.0 if `index` or `dim` is out of range.
+    pub fn out_voronoi_point(&self, index: usize, dim: usize) -> f64 {
+        unsafe { tri_out_voronoi_point(self.ext_trigen, to_i32(index), to_i32(dim)) }
+    }
+
+    /// Returns the number of edges on the Voronoi tessellation
+    pub fn out_voronoi_nedge(&self) -> usize {
+        unsafe { tri_out_voronoi_nedge(self.ext_trigen) as usize }
+    }
+
+    /// Returns the index of the first endpoint on a Voronoi edge
+    ///
+    /// # Input
+    ///
+    /// * `index` -- is the index of the edge and goes from 0 to `out_voronoi_nedge`
+    ///
+    /// # Warning
+    ///
+    /// This function will return 0 if `index` is out of range.
+    pub fn out_voronoi_edge_point_a(&self, index: usize) -> usize {
+        unsafe { tri_out_voronoi_edge_point(self.ext_trigen, to_i32(index), 0) as usize }
+    }
+
+    /// Returns the index of the second endpoint on a Voronoi edge or the direction of the Voronoi edge
+    ///
+    /// # Input
+    ///
+    /// * `index` -- is the index of the edge and goes from 0 to `out_voronoi_nedge`
+    ///
+    /// # Warning
+    ///
+    /// This function will return Index(0) if `index` is out of range.
+    pub fn out_voronoi_edge_point_b(&self, index: usize) -> VoronoiEdgePoint {
+        unsafe {
+            let index_i32 = to_i32(index);
+            let id = tri_out_voronoi_edge_point(self.ext_trigen, index_i32, 1);
+            if id == -1 {
+                let x = tri_out_voronoi_edge_point_b_direction(self.ext_trigen, index_i32, 0);
+                let y = tri_out_voronoi_edge_point_b_direction(self.ext_trigen, index_i32, 1);
+                VoronoiEdgePoint::Direction(x, y)
+            } else {
+                VoronoiEdgePoint::Index(id as usize)
+            }
+        }
+    }
+
+    /// Returns the indices of the finite and the infinite (ray) Voronoi edges
+    ///
+    /// The pair `(finite, infinite)` holds the edge indices whose second endpoint is a
+    /// Voronoi point and those whose dual Delaunay edge lies on the convex hull (rays),
+    /// both in ascending order. The split is computed in one sequential pass on the
+    /// first call after a Voronoi run and cached until the next run, so per-frame
+    /// consumers do not re-check every edge. See the notes in [Trigen::out_points_slice]
+    /// regarding the zero-copy borrow.
+    ///
+    /// # Warning
+    ///
+    /// This function is only available after calling [Trigen::generate_voronoi] (or
+    /// [Trigen::voronoi_from_delaunay])
+    pub fn out_voronoi_edge_split(&self) -> Result<(&[i32], &[i32]), StrError> {
+        unsafe {
+            let mut finite: *const i32 = std::ptr::null();
+            let mut infinite: *const i32 = std::ptr::null();
+            let mut n_finite: i32 = 0;
+            let mut n_infinite: i32 = 0;
+            let status = tri_out_voronoi_edge_split(
+                self.ext_trigen,
+                &mut finite,
+                &mut n_finite,
+                &mut infinite,
+                &mut n_infinite,
+            );
+            handle_status(status)?;
+            Ok((
+                std::slice::from_raw_parts(finite, n_finite as usize),
+                std::slice::from_raw_parts(infinite, n_infinite as usize),
+            ))
+        }
+    }
+
+    /// Returns all Voronoi edge endpoints as a borrowed slice
+    ///
+    /// The slice has length `2 * out_voronoi_nedge` and is organized as
+    /// `[a0, b0, a1, b1, ...]`; a second endpoint of `-1` means the edge is an
+    /// infinite ray (see [Trigen::out_voronoi_directions_slice]). See the notes in
+    /// [Trigen::out_points_slice] regarding the zero-copy borrow.
+    ///
+    /// **Note:** An empty slice is returned if no Voronoi diagram has been generated yet.
+    pub fn out_voronoi_edges_slice(&self) -> &[i32] {
+        unsafe {
+            let ptr = tri_out_voronoi_edge_list(self.ext_trigen);
+            let nedge = tri_out_voronoi_nedge(self.ext_trigen) as usize;
+            if ptr.is_null() || nedge == 0 {
+                return &[];
+            }
+            std::slice::from_raw_parts(ptr, nedge * 2)
+        }
+    }
+
+    /// Returns all Voronoi ray directions as a borrowed slice
+    ///
+    /// The slice has length `2 * out_voronoi_nedge` and is organized as
+    /// `[x0, y0, x1, y1, ...]`; the entries are only meaningful for the infinite
+    /// (ray) edges, i.e., those whose second endpoint is `-1` (the others are zero).
+    /// Together with [Trigen::out_voronoi_edge_split], a consumer reads every ray
+    /// of a large diagram with two bulk accesses instead of per-edge calls. See the
+    /// notes in [Trigen::out_points_slice] regarding the zero-copy borrow.
+    ///
+    /// **Note:** An empty slice is returned if no Voronoi diagram has been generated yet.
+    pub fn out_voronoi_directions_slice(&self) -> &[f64] {
+        unsafe {
+            let ptr = tri_out_voronoi_direction_list(self.ext_trigen);
+            let nedge = tri_out_voronoi_nedge(self.ext_trigen) as usize;
+            if ptr.is_null() || nedge == 0 {
+                return &[];
+            }
+            std::slice::from_raw_parts(ptr, nedge * 2)
+        }
+    }
+
+    /// Returns the memory pool usage captured by the last run
+    ///
+    /// Returns all zeros before the first generate call.
+    pub fn pool_stats(&self) -> TriPoolStats {
+        let mut stats = TriPoolStats::default();
+        unsafe {
+            tri_out_pool_stats(self.ext_trigen, &mut stats);
+        }
+        stats
+    }
+
+    /// Draw triangles
+    pub fn draw_triangles(
+        &self,
+        plot: &mut Plot,
+        set_range: bool,
+        with_point_ids: bool,
+        with_triangle_ids: bool,
+        with_attribute_ids: bool,
+        fontsize_point_ids: Option<f64>,
+        fontsize_triangle_ids: Option<f64>,
+        fontsize_attribute_ids: Option<f64>,
+    ) {
+        let n_triangle = self.out_ncell();
+        if n_triangle < 1 {
+            return;
+        }
+        let mut canvas = Canvas::new();
+        let mut point_ids = Text::new();
+        let mut triangle_ids = Text::new();
+        let mut attribute_ids = Text::new();
+        if with_point_ids {
+            point_ids
                 .set_color("red")
                 .set_align_horizontal("center")
                 .set_align_vertical("center")
@@ -939,7 +1757,7 @@ impl Trigen {
 
 #[cfg(test)]
 mod tests {
-    use super::Trigen;
+    use super::{TriPoolStats, Trigen};
     use crate::{StrError, VoronoiEdgePoint};
     use plotpy::Plot;
 
@@ -1084,6 +1902,641 @@ mod tests {
         Ok(())
     }
 
+    #[test]
+    fn set_batch_captures_some_errors() -> Result<(), StrError> {
+        let mut trigen = Trigen::new(3, None, None, None)?;
+        assert_eq!(
+            trigen.set_points_batch(&[0.0, 0.0], &[0, 0, 0]).err(),
+            Some("coords.len() must be equal to 2 · npoint")
+        );
+        assert_eq!(
+            trigen.set_points_batch(&[0.0; 6], &[0, 0]).err(),
+            Some("markers.len() must be equal to npoint")
+        );
+        assert_eq!(
+            trigen.set_segments_batch(&[0, 1], &[0]).err(),
+            Some("cannot set segment because the number of segments is None")
+        );
+        let mut trigen = Trigen::new(3, Some(3), None, None)?;
+        assert_eq!(
+            trigen.set_segments_batch(&[0, 1], &[0, 0, 0]).err(),
+            Some("segments.len() must be equal to 2 · nsegment")
+        );
+        assert_eq!(
+            trigen.set_segments_batch(&[0, 1, 1, 2, 2, 0], &[0]).err(),
+            Some("markers.len() must be equal to nsegment")
+        );
+        assert_eq!(
+            trigen.set_segments_batch(&[0, 1, 1, 2, 2, 4], &[0, 0, 0]).err(),
+            Some("id of segment point is out of bounds")
+        );
+        Ok(())
+    }
+
+    #[test]
+    fn set_batch_works() -> Result<(), StrError> {
+        let mut trigen = Trigen::new(3, Some(3), None, None)?;
+        trigen
+            .set_points_batch(&[0.0, 0.0, 1.0, 0.0, 0.0, 1.0], &[-100, -200, -300])?
+            .set_segments_batch(&[0, 1, 1, 2, 2, 0], &[-10, -20, -30])?;
+        trigen.generate_mesh(false, false, false, None, None)?;
+        assert_eq!(trigen.out_npoint(), 3);
+        assert_eq!(trigen.out_ncell(), 1);
+        assert_eq!(trigen.out_point_markers_slice(), &[-100, -200, -300]);
+        assert_eq!(trigen.out_segment_markers_slice(), &[-10, -20, -30]);
+        Ok(())
+    }
+
+    #[test]
+    fn out_slices_work() -> Result<(), StrError> {
+        let mut trigen = Trigen::new(3, Some(3), None, None)?;
+        assert_eq!(trigen.out_points_slice(), &[] as &[f64]);
+        assert_eq!(trigen.out_point_markers_slice(), &[] as &[i32]);
+        assert_eq!(trigen.out_segments_slice(), &[] as &[i32]);
+        assert_eq!(trigen.out_segment_markers_slice(), &[] as &[i32]);
+        assert_eq!(trigen.out_cell_points_slice(), &[] as &[i32]);
+        trigen
+            .set_point(0, -100, 0.0, 0.0)?
+            .set_point(1, -200, 1.0, 0.0)?
+            .set_point(2, -300, 0.0, 1.0)?;
+        trigen
+            .set_segment(0, -10, 0, 1)?
+            .set_segment(1, -20, 1, 2)?
+            .set_segment(2, -30, 2, 0)?;
+        trigen.generate_mesh(false, false, false, None, None)?;
+        assert_eq!(trigen.out_points_slice(), &[0.0, 0.0, 1.0, 0.0, 0.0, 1.0]);
+        assert_eq!(trigen.out_point_markers_slice(), &[-100, -200, -300]);
+        assert_eq!(trigen.out_segments_slice(), &[1, 0, 2, 1, 0, 2]);
+        assert_eq!(trigen.out_segment_markers_slice(), &[-10, -20, -30]);
+        assert_eq!(trigen.out_cell_points_slice(), &[0, 1, 2]);
+        Ok(())
+    }
+
+    #[test]
+    fn rerun_works() -> Result<(), StrError> {
+        let mut trigen = Trigen::new(3, None, None, None)?;
+        trigen.set_points_batch(&[0.0, 0.0, 1.0, 0.0, 0.0, 1.0], &[0, 0, 0])?;
+        trigen.generate_delaunay(false)?;
+        assert_eq!(trigen.out_npoint(), 3);
+        assert_eq!(trigen.out_points_slice(), &[0.0, 0.0, 1.0, 0.0, 0.0, 1.0]);
+        // rerun with new coordinates; the output arrays are recycled
+        trigen.set_points_batch(&[0.0, 0.0, 2.0, 0.0, 0.0, 2.0], &[0, 0, 0])?;
+        trigen.generate_delaunay(false)?;
+        assert_eq!(trigen.out_npoint(), 3);
+        assert_eq!(trigen.out_points_slice(), &[0.0, 0.0, 2.0, 0.0, 0.0, 2.0]);
+        trigen.generate_voronoi(false)?;
+        assert_eq!(trigen.out_voronoi_npoint(), 1);
+        trigen.generate_voronoi(false)?;
+        assert_eq!(trigen.out_voronoi_npoint(), 1);
+        // rerun quality meshes with different constraints
+        let mut trigen = Trigen::new(3, Some(3), None, None)?;
+        trigen.set_points_batch(&[0.0, 0.0, 1.0, 0.0, 0.0, 1.0], &[0, 0, 0])?;
+        trigen.set_segments_batch(&[0, 1, 1, 2, 2, 0], &[0, 0, 0])?;
+        trigen.generate_mesh(false, false, false, None, None)?;
+        assert_eq!(trigen.out_ncell(), 1);
+        trigen.generate_mesh(false, false, true, Some(0.1), None)?;
+        assert!(trigen.out_ncell() > 1);
+        Ok(())
+    }
+
+    #[test]
+    fn insert_points_captures_some_errors() -> Result<(), StrError> {
+        let mut trigen = Trigen::new(4, None, None, None)?;
+        assert_eq!(
+            trigen.insert_points(&[0.5]).err(),
+            Some("coords.len() must be a positive multiple of 2")
+        );
+        assert_eq!(
+            trigen.insert_points(&[0.5, 0.5]).err(),
+            Some("there is no triangulation from a previous run")
+        );
+        trigen.set_points_batch(&[0.0, 0.0, 1.0, 0.0, 1.0, 1.0, 0.0, 1.0], &[0, 0, 0, 0])?;
+        trigen.generate_delaunay(false)?;
+        assert_eq!(
+            trigen.insert_points(&[2.0, 2.0]).err(),
+            Some("cannot insert point: it lies outside the convex hull or coincides with an existing point")
+        );
+        assert_eq!(
+            trigen.insert_points(&[1.0, 1.0]).err(),
+            Some("cannot insert point: it lies outside the convex hull or coincides with an existing point")
+        );
+        Ok(())
+    }
+
+    #[test]
+    fn insert_points_works() -> Result<(), StrError> {
+        let mut trigen = Trigen::new(4, None, None, None)?;
+        trigen.set_points_batch(&[0.0, 0.0, 1.0, 0.0, 1.0, 1.0, 0.0, 1.0], &[-1, -2, -3, -4])?;
+        trigen.generate_delaunay(false)?;
+        assert_eq!(trigen.out_npoint(), 4);
+        assert_eq!(trigen.out_ncell(), 2);
+        // insert the center of the square (cocircular with all four corners)
+        trigen.insert_points(&[0.5, 0.5])?;
+        assert_eq!(trigen.out_npoint(), 5);
+        assert_eq!(trigen.out_ncell(), 4);
+        // insert a batch of interior points; each insertion adds exactly two triangles
+        trigen.insert_points(&[0.25, 0.25, 0.75, 0.25, 0.75, 0.75, 0.25, 0.75, 0.5, 0.25])?;
+        assert_eq!(trigen.out_npoint(), 10);
+        assert_eq!(trigen.out_ncell(), 14);
+        // the triangulation stays valid: positive areas summing to the area of the square
+        let points = trigen.out_points_slice();
+        let mut total_area = 0.0;
+        for t in trigen.out_cell_points_slice().chunks(3) {
+            let (xa, ya) = (points[t[0] as usize * 2], points[t[0] as usize * 2 + 1]);
+            let (xb, yb) = (points[t[1] as usize * 2], points[t[1] as usize * 2 + 1]);
+            let (xc, yc) = (points[t[2] as usize * 2], points[t[2] as usize * 2 + 1]);
+            let area = 0.5 * ((xb - xa) * (yc - ya) - (xc - xa) * (yb - ya));
+            assert!(area > 0.0);
+            total_area += area;
+        }
+        assert!(f64::abs(total_area - 1.0) < 1e-14);
+        // the original point markers are preserved
+        assert_eq!(&trigen.out_point_markers_slice()[..4], &[-1, -2, -3, -4]);
+        Ok(())
+    }
+
+    #[test]
+    fn move_points_captures_some_errors() -> Result<(), StrError> {
+        let mut trigen = Trigen::new(5, None, None, None)?;
+        assert_eq!(
+            trigen.move_points(&[0.5]).err(),
+            Some("coords.len() must be a positive multiple of 2")
+        );
+        assert_eq!(
+            trigen.move_points(&[0.5, 0.5]).err(),
+            Some("there is no triangulation from a previous run")
+        );
+        // square corners plus center: four triangles around the center
+        let coords = [0.0, 0.0, 1.0, 0.0, 1.0, 1.0, 0.0, 1.0, 0.5, 0.5];
+        trigen.set_points_batch(&coords, &[0; 5])?;
+        trigen.generate_delaunay(false)?;
+        assert_eq!(
+            trigen.move_points(&[0.0, 0.0]).err(),
+            Some("batch array length does not match the allocated number of entities")
+        );
+        // moving the center outside the square inverts the triangles attached to it
+        let inverted = [0.0, 0.0, 1.0, 0.0, 1.0, 1.0, 0.0, 1.0, 2.0, 0.5];
+        assert_eq!(
+            trigen.move_points(&inverted).err(),
+            Some("the moved points invert some triangles; a full retriangulation is needed")
+        );
+        // the failed call leaves the output untouched
+        assert_eq!(trigen.out_point(4, 0), 0.5);
+        assert_eq!(trigen.out_ncell(), 4);
+        Ok(())
+    }
+
+    #[test]
+    fn move_points_works() -> Result<(), StrError> {
+        // a small displacement of one vertex of this quadrilateral switches the
+        // Delaunay diagonal, so the relocation must perform an edge flip
+        let mut trigen = Trigen::new(4, None, None, None)?;
+        trigen.set_points_batch(&[0.0, 0.0, 1.0, 0.0, 1.01, 1.0, 0.0, 1.0], &[0; 4])?;
+        trigen.generate_delaunay(false)?;
+        assert_eq!(trigen.out_ncell(), 2);
+        let edges_before = edge_set(&trigen);
+        let moved = [0.0, 0.0, 1.0, 0.0, 0.99, 1.0, 0.0, 1.0];
+        trigen.move_points(&moved)?;
+        assert_eq!(trigen.out_ncell(), 2);
+        assert_eq!(trigen.out_point(2, 0), 0.99);
+        let edges_after = edge_set(&trigen);
+        assert_ne!(edges_before, edges_after); // the diagonal was flipped
+        let mut fresh = Trigen::new(4, None, None, None)?;
+        fresh.set_points_batch(&moved, &[0; 4])?;
+        fresh.generate_delaunay(false)?;
+        assert_eq!(edges_after, edge_set(&fresh));
+
+        // an irregular cloud jiggled by small offsets: the relocated triangulation
+        // must coincide with a fresh Delaunay triangulation of the moved points
+        #[rustfmt::skip]
+        let coords = [
+            0.0, 0.0, 10.0, 0.0, 10.0, 10.0, 0.0, 10.0, // hull square
+            2.3, 1.7, 7.1, 2.2, 5.4, 4.8, 1.9, 6.3, // interior
+            8.2, 7.4, 4.1, 8.6, 6.6, 6.1, 3.3, 3.9,
+        ];
+        let mut trigen = Trigen::new(12, None, None, None)?;
+        trigen.set_points_batch(&coords, &[0; 12])?;
+        trigen.generate_delaunay(false)?;
+        let moved: Vec<f64> = coords
+            .iter()
+            .enumerate()
+            .map(|(i, v)| if i < 8 { *v } else { *v + 0.08 * ((i % 5) as f64 - 2.0) })
+            .collect();
+        trigen.move_points(&moved)?;
+        let mut fresh = Trigen::new(12, None, None, None)?;
+        fresh.set_points_batch(&moved, &[0; 12])?;
+        fresh.generate_delaunay(false)?;
+        assert_eq!(trigen.out_ncell(), fresh.out_ncell());
+        assert_eq!(edge_set(&trigen), edge_set(&fresh));
+        Ok(())
+    }
+
+    #[test]
+    fn move_points_keeps_constrained_edges() -> Result<(), StrError> {
+        let mut trigen = Trigen::new(4, Some(4), None, None)?;
+        trigen.set_points_batch(&[0.0, 0.0, 1.0, 0.0, 1.0, 1.0, 0.0, 1.0], &[0, 0, 0, 0])?;
+        trigen.set_segments_batch(&[0, 1, 1, 2, 2, 3, 3, 0], &[0, 0, 0, 0])?;
+        trigen.generate_mesh(false, false, true, Some(0.1), None)?;
+        let npoint = trigen.out_npoint();
+        let nsegment = trigen.out_nsegment();
+        let segments_before: Vec<_> = (0..nsegment)
+            .map(|i| (trigen.out_segment_point(i, 0), trigen.out_segment_point(i, 1)))
+            .collect();
+        // jiggle the interior (Steiner) points only; the boundary stays put
+        let mut moved = trigen.out_points_slice().to_vec();
+        for i in 0..npoint {
+            if trigen.out_point_marker(i) == 0 {
+                moved[i * 2] += 0.005;
+                moved[i * 2 + 1] -= 0.005;
+            }
+        }
+        trigen.move_points(&moved)?;
+        // the mesh stays valid: positive areas summing to the area of the square
+        let points = trigen.out_points_slice();
+        let mut total_area = 0.0;
+        for t in trigen.out_cell_points_slice().chunks(3) {
+            let (xa, ya) = (points[t[0] as usize * 2], points[t[0] as usize * 2 + 1]);
+            let (xb, yb) = (points[t[1] as usize * 2], points[t[1] as usize * 2 + 1]);
+            let (xc, yc) = (points[t[2] as usize * 2], points[t[2] as usize * 2 + 1]);
+            let area = 0.5 * ((xb - xa) * (yc - ya) - (xc - xa) * (yb - ya));
+            assert!(area > 0.0);
+            total_area += area;
+        }
+        assert!(f64::abs(total_area - 1.0) < 1e-14);
+        // the constrained segments are untouched
+        let segments_after: Vec<_> = (0..nsegment)
+            .map(|i| (trigen.out_segment_point(i, 0), trigen.out_segment_point(i, 1)))
+            .collect();
+        assert_eq!(segments_before, segments_after);
+        Ok(())
+    }
+
+    #[test]
+    fn move_points_updates_neighbors() -> Result<(), StrError> {
+        // the same diagonal switch as in move_points_works, but on a mesh run so
+        // that the neighbor and edge lists exist and must be kept consistent
+        let mut trigen = Trigen::new(4, Some(4), None, None)?;
+        trigen.set_points_batch(&[0.0, 0.0, 1.0, 0.0, 1.01, 1.0, 0.0, 1.0], &[0; 4])?;
+        trigen.set_segments_batch(&[0, 1, 1, 2, 2, 3, 3, 0], &[0; 4])?;
+        trigen.generate_mesh(false, false, false, None, None)?;
+        assert_eq!(trigen.out_ncell(), 2);
+        assert_eq!(trigen.out_nedge(), 5);
+        trigen.move_points(&[0.0, 0.0, 1.0, 0.0, 0.99, 1.0, 0.0, 1.0])?;
+        check_neighbors(&trigen);
+        // the flipped diagonal invalidates the edge list; it must be dropped
+        assert_eq!(trigen.out_nedge(), 0);
+        assert_eq!(trigen.out_edges_slice(), &[] as &[i32]);
+
+        // a refined mesh jiggled by small interior offsets: every neighbor entry
+        // must still be reciprocal and share the side opposite its corner
+        let mut trigen = Trigen::new(4, Some(4), None, None)?;
+        trigen.set_points_batch(&[0.0, 0.0, 1.0, 0.0, 1.0, 1.0, 0.0, 1.0], &[0; 4])?;
+        trigen.set_segments_batch(&[0, 1, 1, 2, 2, 3, 3, 0], &[0; 4])?;
+        trigen.generate_mesh(false, false, true, Some(0.05), None)?;
+        let npoint = trigen.out_npoint();
+        let mut moved = trigen.out_points_slice().to_vec();
+        for i in 0..npoint {
+            if trigen.out_point_marker(i) == 0 {
+                moved[i * 2] += 0.01 * (((i % 3) as f64) - 1.0);
+                moved[i * 2 + 1] += 0.01 * (((i % 5) as f64) - 2.0);
+            }
+        }
+        trigen.move_points(&moved)?;
+        check_neighbors(&trigen);
+        Ok(())
+    }
+
+    /// Checks that every neighbor entry is reciprocal and lies across the side
+    /// opposite its corner (Triangle's convention)
+    fn check_neighbors(trigen: &Trigen) {
+        let ncell = trigen.out_ncell();
+        let neighbors = trigen.out_neighbors_slice();
+        assert_eq!(neighbors.len(), ncell * 3);
+        for t in 0..ncell {
+            let corners: Vec<usize> = (0..3).map(|m| trigen.out_cell_point(t, m)).collect();
+            for e in 0..3 {
+                let u = trigen.out_cell_neighbor(t, e);
+                assert_eq!(u, neighbors[t * 3 + e]);
+                if u < 0 {
+                    continue;
+                }
+                let others: Vec<usize> = (0..3).map(|m| trigen.out_cell_point(u as usize, m)).collect();
+                // the neighbor shares the two corners flanking corner e, not corner e
+                assert!(others.contains(&corners[(e + 1) % 3]));
+                assert!(others.contains(&corners[(e + 2) % 3]));
+                assert!(!others.contains(&corners[e]));
+                // and points back at this triangle from the shared side
+                let f = (0..3).find(|f| trigen.out_cell_neighbor(u as usize, *f) == t as i32);
+                assert!(f.is_some());
+                assert!(!corners.contains(&others[f.unwrap()]));
+            }
+        }
+    }
+
+    #[test]
+    fn adopt_output_as_input_works() -> Result<(), StrError> {
+        let mut trigen = Trigen::new(4, Some(4), None, None)?;
+        assert_eq!(
+            trigen.adopt_output_as_input().err(),
+            Some("there is no triangulation from a previous run")
+        );
+        trigen.set_points_batch(&[0.0, 0.0, 1.0, 0.0, 1.0, 1.0, 0.0, 1.0], &[0, 0, 0, 0])?;
+        trigen.set_segments_batch(&[0, 1, 1, 2, 2, 3, 3, 0], &[0, 0, 0, 0])?;
+        trigen.generate_mesh(false, false, true, Some(0.1), None)?;
+        let npoint = trigen.out_npoint();
+        let points_before = trigen.out_points_slice().to_vec();
+        assert!(npoint > 4);
+        // the refined point set becomes the input; the output is consumed
+        trigen.adopt_output_as_input()?;
+        assert_eq!(trigen.out_npoint(), 0);
+        assert_eq!(trigen.out_ncell(), 0);
+        // re-triangulate (Delaunay) the adopted points without any round-trip
+        trigen.generate_delaunay(false)?;
+        assert_eq!(trigen.out_npoint(), npoint);
+        assert!(trigen.out_ncell() > 0);
+        assert_eq!(trigen.out_points_slice(), points_before.as_slice());
+        Ok(())
+    }
+
+    #[test]
+    fn quality_stats_works() -> Result<(), StrError> {
+        let mut trigen = Trigen::new(4, Some(4), None, None)?;
+        assert_eq!(trigen.out_quality_histogram(0).err(), Some("nbin must be at least 1"));
+        assert_eq!(trigen.out_worst_cells(0).err(), Some("nworst must be at least 1"));
+        assert_eq!(
+            trigen.out_quality_histogram(6).err(),
+            Some("there is no triangulation from a previous run")
+        );
+        trigen.set_points_batch(&[0.0, 0.0, 1.0, 0.0, 1.0, 1.0, 0.0, 1.0], &[0, 0, 0, 0])?;
+        trigen.set_segments_batch(&[0, 1, 1, 2, 2, 3, 3, 0], &[0, 0, 0, 0])?;
+        trigen.generate_mesh(false, false, true, Some(0.1), Some(30.0))?;
+        let ncell = trigen.out_ncell();
+        let (histogram, min_quality, max_quality) = trigen.out_quality_histogram(6)?;
+        assert_eq!(histogram.iter().sum::<i64>(), ncell as i64);
+        assert!(min_quality >= 30.0 && min_quality <= max_quality && max_quality <= 60.0);
+        // cross-check against a plain re-computation of the per-cell minimum angle
+        let points = trigen.out_points_slice();
+        let min_angle = |t: &[i32]| -> f64 {
+            let mut worst: f64 = 180.0;
+            for k in 0..3 {
+                let (a, b, c) = (t[k] as usize, t[(k + 1) % 3] as usize, t[(k + 2) % 3] as usize);
+                let (ux, uy) = (points[b * 2] - points[a * 2], points[b * 2 + 1] - points[a * 2 + 1]);
+                let (vx, vy) = (points[c * 2] - points[a * 2], points[c * 2 + 1] - points[a * 2 + 1]);
+                let cosang = (ux * vx + uy * vy) / f64::sqrt((ux * ux + uy * uy) * (vx * vx + vy * vy));
+                worst = f64::min(worst, f64::acos(cosang).to_degrees());
+            }
+            worst
+        };
+        let qualities: Vec<f64> = trigen.out_cell_points_slice().chunks(3).map(min_angle).collect();
+        let qmin = qualities.iter().fold(180.0, |acc: f64, q| acc.min(*q));
+        assert!(f64::abs(min_quality - qmin) < 1e-12);
+        // the worst cells come back sorted, worst first, with matching qualities
+        let worst = trigen.out_worst_cells(3)?;
+        assert_eq!(worst.len(), 3);
+        assert!(f64::abs(worst[0].1 - min_quality) < 1e-15);
+        for i in 0..worst.len() {
+            let (cell, quality) = worst[i];
+            assert!(f64::abs(quality - qualities[cell]) < 1e-12);
+            if i > 0 {
+                assert!(worst[i - 1].1 <= quality);
+            }
+        }
+        Ok(())
+    }
+
+    #[test]
+    fn edges_output_works() -> Result<(), StrError> {
+        let mut trigen = Trigen::new(4, Some(4), None, None)?;
+        assert_eq!(trigen.out_nedge(), 0);
+        assert_eq!(trigen.out_edges_slice(), &[] as &[i32]);
+        assert_eq!(trigen.out_edge_markers_slice(), &[] as &[i32]);
+        trigen.set_points_batch(&[0.0, 0.0, 1.0, 0.0, 1.0, 1.0, 0.0, 1.0], &[0, 0, 0, 0])?;
+        trigen.set_segments_batch(&[0, 1, 1, 2, 2, 3, 3, 0], &[-10, -20, -30, -40])?;
+        trigen.generate_mesh(false, false, true, Some(0.1), None)?;
+        let nedge = trigen.out_nedge();
+        // Euler's formula for a planar connected mesh: V - E + (T + 1) = 2
+        let (v, e, t) = (trigen.out_npoint() as i64, nedge as i64, trigen.out_ncell() as i64);
+        assert_eq!(v - e + t + 1, 2);
+        // the emitted edges coincide with the unique edges derived from the cells
+        let mut from_list: Vec<(i32, i32)> = trigen
+            .out_edges_slice()
+            .chunks(2)
+            .map(|e| (i32::min(e[0], e[1]), i32::max(e[0], e[1])))
+            .collect();
+        from_list.sort();
+        assert_eq!(from_list, edge_set(&trigen));
+        // boundary edges carry the marker of their segment; interior edges carry zero
+        let markers = trigen.out_edge_markers_slice();
+        assert_eq!(markers.len(), nedge);
+        let nbry = markers.iter().filter(|m| **m != 0).count();
+        assert_eq!(nbry, trigen.out_nsegment());
+        for i in 0..nedge {
+            assert_eq!(trigen.out_edge_point(i, 0), trigen.out_edges_slice()[i * 2] as usize);
+            assert_eq!(
+                trigen.out_edge_point(i, 1),
+                trigen.out_edges_slice()[i * 2 + 1] as usize
+            );
+            assert_eq!(trigen.out_edge_marker(i), markers[i]);
+            if markers[i] != 0 {
+                assert!(markers[i] <= -10); // one of the four segment markers
+            }
+        }
+        // a later Delaunay run updates the edge count without rewriting the edge
+        // arrays (no -e switch); the stale arrays must be discarded, not kept
+        trigen.generate_delaunay(false)?;
+        assert_eq!(trigen.out_nedge(), 0);
+        assert_eq!(trigen.out_edges_slice(), &[] as &[i32]);
+        assert_eq!(trigen.out_edge_markers_slice(), &[] as &[i32]);
+        Ok(())
+    }
+
+    /// Returns the sorted set of undirected edges of the output triangulation
+    fn edge_set(trigen: &Trigen) -> Vec<(i32, i32)> {
+        let mut edges = Vec::new();
+        for t in trigen.out_cell_points_slice().chunks(3) {
+            for e in 0..3 {
+                let (a, b) = (t[e], t[(e + 1) % 3]);
+                edges.push((i32::min(a, b), i32::max(a, b)));
+            }
+        }
+        edges.sort();
+        edges.dedup();
+        edges
+    }
+
+    #[test]
+    fn out_neighbors_work() -> Result<(), StrError> {
+        let mut trigen = Trigen::new(4, Some(4), None, None)?;
+        assert_eq!(trigen.out_neighbors_slice(), &[] as &[i32]);
+        assert_eq!(trigen.out_cell_neighbor(0, 0), -1);
+        trigen.set_points_batch(&[0.0, 0.0, 1.0, 0.0, 1.0, 1.0, 0.0, 1.0], &[0, 0, 0, 0])?;
+        trigen.set_segments_batch(&[0, 1, 1, 2, 2, 3, 3, 0], &[0, 0, 0, 0])?;
+        trigen.generate_mesh(false, false, false, None, None)?;
+        assert_eq!(trigen.out_ncell(), 2);
+        let neighbors = trigen.out_neighbors_slice();
+        assert_eq!(neighbors.len(), 6);
+        // each triangle has exactly one neighbor (the other) and two boundary sides
+        for t in 0..2 {
+            let row = &neighbors[t * 3..t * 3 + 3];
+            assert_eq!(row.iter().filter(|n| **n == -1).count(), 2);
+            assert_eq!(row.iter().filter(|n| **n == 1 - t as i32).count(), 1);
+            for side in 0..3 {
+                assert_eq!(trigen.out_cell_neighbor(t, side), row[side]);
+            }
+        }
+        Ok(())
+    }
+
+    #[test]
+    fn voronoi_from_delaunay_works() -> Result<(), StrError> {
+        let mut trigen = Trigen::new(5, None, None, None)?;
+        assert_eq!(
+            trigen.voronoi_from_delaunay().err(),
+            Some("there is no triangulation from a previous run")
+        );
+        trigen
+            .set_point(0, 0, 0.0, 0.0)?
+            .set_point(1, 0, 1.0, 0.0)?
+            .set_point(2, 0, 0.0, 1.0)?
+            .set_point(3, 0, 1.0, 1.0)?
+            .set_point(4, 0, 0.5, 0.5)?;
+        trigen.generate_delaunay(false)?;
+        trigen.voronoi_from_delaunay()?;
+        // one Voronoi point per triangle and one Voronoi edge per Delaunay edge
+        assert_eq!(trigen.out_voronoi_npoint(), 4);
+        assert_eq!(trigen.out_voronoi_nedge(), 8);
+        // every Voronoi point is the circumcenter of its triangle (equidistant corners)
+        for t in 0..trigen.out_ncell() {
+            let (vx, vy) = (trigen.out_voronoi_point(t, 0), trigen.out_voronoi_point(t, 1));
+            let mut radius = Vec::new();
+            for m in 0..3 {
+                let p = trigen.out_cell_point(t, m);
+                let (dx, dy) = (trigen.out_point(p, 0) - vx, trigen.out_point(p, 1) - vy);
+                radius.push(f64::sqrt(dx * dx + dy * dy));
+            }
+            assert!(f64::abs(radius[0] - radius[1]) < 1e-15);
+            assert!(f64::abs(radius[0] - radius[2]) < 1e-15);
+        }
+        // the hull edges dualize to infinite rays; the interior edges are finite
+        let mut nray = 0;
+        for e in 0..trigen.out_voronoi_nedge() {
+            match trigen.out_voronoi_edge_point_b(e) {
+                VoronoiEdgePoint::Index(index) => assert!(index < trigen.out_voronoi_npoint()),
+                VoronoiEdgePoint::Direction(dx, dy) => {
+                    assert!(dx != 0.0 || dy != 0.0);
+                    nray += 1;
+                }
+            }
+        }
+        assert_eq!(nray, 4);
+        Ok(())
+    }
+
+    #[test]
+    fn voronoi_edge_split_works() -> Result<(), StrError> {
+        let mut trigen = Trigen::new(5, None, None, None)?;
+        assert_eq!(
+            trigen.out_voronoi_edge_split().err(),
+            Some("there is no Voronoi diagram to access")
+        );
+        trigen
+            .set_point(0, 0, 0.0, 0.0)?
+            .set_point(1, 0, 1.0, 0.0)?
+            .set_point(2, 0, 0.0, 1.0)?
+            .set_point(3, 0, 1.0, 1.0)?
+            .set_point(4, 0, 0.5, 0.5)?;
+        trigen.generate_voronoi(false)?;
+        let nedge = trigen.out_voronoi_nedge();
+        let (finite, infinite) = trigen.out_voronoi_edge_split()?;
+        assert_eq!(finite.len() + infinite.len(), nedge);
+        assert!(finite.windows(2).all(|w| w[0] < w[1]));
+        assert!(infinite.windows(2).all(|w| w[0] < w[1]));
+
+        // the split and the bulk arrays agree with the per-edge accessors
+        let edges = trigen.out_voronoi_edges_slice();
+        let directions = trigen.out_voronoi_directions_slice();
+        assert_eq!(edges.len(), nedge * 2);
+        assert_eq!(directions.len(), nedge * 2);
+        for e in finite {
+            let e = *e as usize;
+            assert_eq!(edges[e * 2] as usize, trigen.out_voronoi_edge_point_a(e));
+            match trigen.out_voronoi_edge_point_b(e) {
+                VoronoiEdgePoint::Index(index) => assert_eq!(edges[e * 2 + 1] as usize, index),
+                VoronoiEdgePoint::Direction(..) => panic!("the edge must be finite"),
+            }
+        }
+        for e in infinite {
+            let e = *e as usize;
+            assert_eq!(edges[e * 2 + 1], -1);
+            match trigen.out_voronoi_edge_point_b(e) {
+                VoronoiEdgePoint::Index(_) => panic!("the edge must be a ray"),
+                VoronoiEdgePoint::Direction(dx, dy) => {
+                    assert_eq!(directions[e * 2], dx);
+                    assert_eq!(directions[e * 2 + 1], dy);
+                }
+            }
+        }
+
+        // the cached split survives repeated calls and the next run rebuilds it
+        let (finite_again, _) = trigen.out_voronoi_edge_split()?;
+        assert_eq!(finite_again, finite);
+        trigen.voronoi_from_delaunay()?;
+        let (finite_new, infinite_new) = trigen.out_voronoi_edge_split()?;
+        assert_eq!(finite_new.len() + infinite_new.len(), trigen.out_voronoi_nedge());
+        Ok(())
+    }
+
+    #[test]
+    fn mesh_parallel_works() -> Result<(), StrError> {
+        let mut trigen = Trigen::new(4, Some(4), None, None)?;
+        trigen.set_points_batch(&[0.0, 0.0, 1.0, 0.0, 1.0, 1.0, 0.0, 1.0], &[-100, -200, -300, -400])?;
+        trigen.set_segments_batch(&[0, 1, 1, 2, 2, 3, 3, 0], &[-10, -20, -30, -40])?;
+        trigen.generate_mesh_parallel(false, Some(0.01), None, 3)?;
+        assert!(trigen.out_ncell() >= 100); // total area is 1.0 and max area is 0.01
+        assert!(trigen.out_nsegment() >= 4); // the boundary segments are subdivided
+                                             // the triangles are positively oriented, respect the area constraint,
+                                             // and cover the whole square
+        let points = trigen.out_points_slice();
+        let mut total_area = 0.0;
+        for t in trigen.out_cell_points_slice().chunks(3) {
+            let (xa, ya) = (points[t[0] as usize * 2], points[t[0] as usize * 2 + 1]);
+            let (xb, yb) = (points[t[1] as usize * 2], points[t[1] as usize * 2 + 1]);
+            let (xc, yc) = (points[t[2] as usize * 2], points[t[2] as usize * 2 + 1]);
+            let area = 0.5 * ((xb - xa) * (yc - ya) - (xc - xa) * (yb - ya));
+            assert!(area > 0.0);
+            assert!(area <= 0.01);
+            total_area += area;
+        }
+        assert!(f64::abs(total_area - 1.0) < 1e-12);
+        // the input point markers are preserved
+        assert_eq!(&trigen.out_point_markers_slice()[..4], &[-100, -200, -300, -400]);
+        // the mesher can run again with different constraints
+        trigen.generate_mesh_parallel(false, Some(0.05), None, 2)?;
+        assert!(trigen.out_ncell() >= 20);
+        trigen.generate_mesh_parallel(false, None, None, 2)?;
+        assert!(trigen.out_ncell() >= 2);
+        Ok(())
+    }
+
+    #[test]
+    fn instances_run_concurrently() -> Result<(), StrError> {
+        // Trigen is Send: instances can be moved to other threads and run in parallel
+        let mut handles = Vec::new();
+        for i in 0..4 {
+            let delta = i as f64;
+            let mut trigen = Trigen::new(3, None, None, None)?;
+            trigen.set_points_batch(&[0.0, 0.0, 1.0 + delta, 0.0, 0.0, 1.0 + delta], &[0, 0, 0])?;
+            handles.push(std::thread::spawn(move || {
+                trigen.generate_delaunay(false).unwrap();
+                trigen.out_point(1, 0)
+            }));
+        }
+        for (i, handle) in handles.into_iter().enumerate() {
+            assert_eq!(handle.join().unwrap(), 1.0 + i as f64);
+        }
+        Ok(())
+    }
+
     #[test]
     fn voronoi_1_works() -> Result<(), StrError> {
         let mut trigen = Trigen::new(5, None, None, None)?;
@@ -1210,6 +2663,27 @@ mod tests {
         Ok(())
     }
 
+    #[test]
+    fn pool_stats_work() -> Result<(), StrError> {
+        let mut trigen = Trigen::new(3, Some(3), None, None)?;
+        assert_eq!(trigen.pool_stats(), TriPoolStats::default()); // all zeros before any run
+        trigen
+            .set_point(0, 0, 0.0, 0.0)?
+            .set_point(1, 0, 1.0, 0.0)?
+            .set_point(2, 0, 0.0, 1.0)?;
+        trigen
+            .set_segment(0, 0, 0, 1)?
+            .set_segment(1, 0, 1, 2)?
+            .set_segment(2, 0, 2, 0)?;
+        trigen.generate_mesh(false, false, true, Some(0.01), None)?;
+        let pools = trigen.pool_stats();
+        assert!(pools.vertices_max_items >= trigen.out_npoint() as i64);
+        assert!(pools.triangles_max_items >= trigen.out_ncell() as i64);
+        assert!(pools.subsegs_max_items >= trigen.out_nsegment() as i64);
+        assert!(pools.pool_peak_bytes > 0);
+        Ok(())
+    }
+
     #[test]
     fn mesh_2_no_steiner_works() -> Result<(), StrError> {
         let mut trigen = Trigen::new(4, Some(4), None, None)?;
@@ -1,10 +1,11 @@
 use crate::constants;
+use crate::conversion::to_i32;
 use crate::StrError;
 use crate::Trigen;
 use std::ffi::OsStr;
 use std::fmt::Write;
 use std::fs::{self, File};
-use std::io::Write as IoWrite;
+use std::io::{BufWriter, Write as IoWrite};
 use std::path::Path;
 
 impl Trigen {
@@ -162,6 +163,180 @@ impl Trigen {
         file.sync_all().map_err(|_| "cannot sync file")?;
         Ok(())
     }
+
+    /// Writes a binary VTU file to visualize the mesh with Paraview
+    ///
+    /// This works like [Trigen::write_vtu] but stores the data as raw appended
+    /// blocks (VTK's `format="appended"` with `encoding="raw"`) and streams them
+    /// through a [BufWriter] -- no float formatting and no in-memory copy of the
+    /// file, which matters for large meshes.
+    ///
+    /// # Input
+    ///
+    /// * `full_path` -- may be a String, &str, or Path
+    pub fn write_vtu_binary<P>(&self, full_path: &P) -> Result<(), StrError>
+    where
+        P: AsRef<OsStr> + ?Sized,
+    {
+        self.write_vtu_binary_with(full_path, false)
+    }
+
+    /// Writes a binary VTU file with optionally narrowed (f32) coordinates
+    ///
+    /// This works like [Trigen::write_vtu_binary] but, with `single_precision`, narrows
+    /// the coordinates to f32 during the streaming write (Paraview ingests either
+    /// width). The coordinates block then takes half the bytes, which adds up quickly
+    /// when writing one file per frame of an animation; the connectivity and the
+    /// markers are unaffected.
+    ///
+    /// # Input
+    ///
+    /// * `full_path` -- may be a String, &str, or Path
+    /// * `single_precision` -- writes the coordinates as f32 instead of f64
+    pub fn write_vtu_binary_with<P>(&self, full_path: &P, single_precision: bool) -> Result<(), StrError>
+    where
+        P: AsRef<OsStr> + ?Sized,
+    {
+        let ntriangle = self.out_ncell();
+        if ntriangle < 1 {
+            return Err("there are no triangles to write");
+        }
+
+        let npoint = self.out_npoint();
+        let nnode = self.out_cell_npoint();
+        let vtk_type = if nnode == 3 {
+            constants::VTK_TRIANGLE
+        } else {
+            constants::VTK_QUADRATIC_TRIANGLE
+        };
+
+        // the appended blocks: each one is a UInt64 byte count followed by raw
+        // little-endian data; the offsets can thus be computed upfront
+        const LEN: u64 = 8; // size of the UInt64 byte count
+        let (float_type, float_width) = if single_precision {
+            ("Float32", 4)
+        } else {
+            ("Float64", 8)
+        };
+        let size_coords = (npoint * 3 * float_width) as u64;
+        let size_connectivity = (ntriangle * nnode * 4) as u64;
+        let size_offsets = (ntriangle * 4) as u64;
+        let size_types = ntriangle as u64;
+        let size_markers = (npoint * 4) as u64;
+        let size_attributes = (ntriangle * 4) as u64;
+        let offset_coords: u64 = 0;
+        let offset_connectivity = offset_coords + LEN + size_coords;
+        let offset_offsets = offset_connectivity + LEN + size_connectivity;
+        let offset_types = offset_offsets + LEN + size_offsets;
+        let offset_markers = offset_types + LEN + size_types;
+        let offset_attributes = offset_markers + LEN + size_markers;
+
+        // create directory
+        let path = Path::new(full_path);
+        if let Some(p) = path.parent() {
+            fs::create_dir_all(p).map_err(|_| "cannot create directory")?;
+        }
+
+        // write file (streaming)
+        let file = File::create(path).map_err(|_| "cannot create file")?;
+        let mut w = BufWriter::new(file);
+        let e = |_| "cannot write file";
+
+        // header
+        write!(
+            &mut w,
+            "<?xml version=\"1.0\"?>\n\
+         <VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\"LittleEndian\" header_type=\"UInt64\">\n\
+         <UnstructuredGrid>\n\
+         <Piece NumberOfPoints=\"{}\" NumberOfCells=\"{}\">\n\
+         <Points>\n\
+         <DataArray type=\"{}\" NumberOfComponents=\"3\" format=\"appended\" offset=\"{}\"/>\n\
+         </Points>\n\
+         <Cells>\n\
+         <DataArray type=\"Int32\" Name=\"connectivity\" format=\"appended\" offset=\"{}\"/>\n\
+         <DataArray type=\"Int32\" Name=\"offsets\" format=\"appended\" offset=\"{}\"/>\n\
+         <DataArray type=\"UInt8\" Name=\"types\" format=\"appended\" offset=\"{}\"/>\n\
+         </Cells>\n\
+         <PointData Scalars=\"TheScalars\">\n\
+         <DataArray type=\"Int32\" Name=\"marker\" NumberOfComponents=\"1\" format=\"appended\" offset=\"{}\"/>\n\
+         </PointData>\n\
+         <CellData Scalars=\"TheScalars\">\n\
+         <DataArray type=\"Int32\" Name=\"attribute\" NumberOfComponents=\"1\" format=\"appended\" offset=\"{}\"/>\n\
+         </CellData>\n\
+         </Piece>\n\
+         </UnstructuredGrid>\n\
+         <AppendedData encoding=\"raw\">\n_",
+            npoint,
+            ntriangle,
+            float_type,
+            offset_coords,
+            offset_connectivity,
+            offset_offsets,
+            offset_types,
+            offset_markers,
+            offset_attributes
+        )
+        .map_err(e)?;
+
+        // nodes: coordinates (z = 0; narrowed to f32 on the fly when requested)
+        w.write_all(&size_coords.to_le_bytes()).map_err(e)?;
+        let coords = self.out_points_slice();
+        for index in 0..npoint {
+            if single_precision {
+                w.write_all(&(coords[index * 2] as f32).to_le_bytes()).map_err(e)?;
+                w.write_all(&(coords[index * 2 + 1] as f32).to_le_bytes()).map_err(e)?;
+                w.write_all(&0.0_f32.to_le_bytes()).map_err(e)?;
+            } else {
+                w.write_all(&coords[index * 2].to_le_bytes()).map_err(e)?;
+                w.write_all(&coords[index * 2 + 1].to_le_bytes()).map_err(e)?;
+                w.write_all(&0.0_f64.to_le_bytes()).map_err(e)?;
+            }
+        }
+
+        // elements: connectivity
+        w.write_all(&size_connectivity.to_le_bytes()).map_err(e)?;
+        for index in 0..ntriangle {
+            for m in 0..nnode {
+                w.write_all(&to_i32(self.out_cell_point(index, m)).to_le_bytes())
+                    .map_err(e)?;
+            }
+        }
+
+        // elements: offsets
+        w.write_all(&size_offsets.to_le_bytes()).map_err(e)?;
+        let mut offset = 0;
+        for _ in 0..ntriangle {
+            offset += nnode;
+            w.write_all(&to_i32(offset).to_le_bytes()).map_err(e)?;
+        }
+
+        // elements: types
+        w.write_all(&size_types.to_le_bytes()).map_err(e)?;
+        for _ in 0..ntriangle {
+            w.write_all(&[vtk_type as u8]).map_err(e)?;
+        }
+
+        // data -- points
+        w.write_all(&size_markers.to_le_bytes()).map_err(e)?;
+        for marker in self.out_point_markers_slice() {
+            w.write_all(&marker.to_le_bytes()).map_err(e)?;
+        }
+
+        // data -- cells
+        w.write_all(&size_attributes.to_le_bytes()).map_err(e)?;
+        for index in 0..ntriangle {
+            w.write_all(&to_i32(self.out_cell_attribute(index)).to_le_bytes())
+                .map_err(e)?;
+        }
+
+        // close AppendedData
+        write!(&mut w, "\n</AppendedData>\n</VTKFile>\n").map_err(e)?;
+
+        // force sync
+        let file = w.into_inner().map_err(|_| "cannot write file")?;
+        file.sync_all().map_err(|_| "cannot sync file")?;
+        Ok(())
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -172,6 +347,79 @@ mod tests {
     use crate::Trigen;
     use std::fs;
 
+    #[test]
+    fn trigen_write_vtu_binary() -> Result<(), StrError> {
+        let mut trigen = Trigen::new(3, None, None, None)?;
+        trigen
+            .set_point(0, 0, 0.0, 0.0)?
+            .set_point(1, 0, 1.0, 0.0)?
+            .set_point(2, 0, 0.0, 1.0)?;
+        trigen.generate_delaunay(false)?;
+        let file_path = "/tmp/tritet/test_trigen_write_vtu_binary.vtu";
+        trigen.write_vtu_binary(file_path)?;
+        let contents = fs::read(file_path).map_err(|_| "cannot open file")?;
+
+        // the header references appended blocks
+        let header = String::from_utf8_lossy(&contents[..contents.len().min(2048)]).to_string();
+        assert!(header.contains("header_type=\"UInt64\""));
+        assert!(
+            header.contains("<DataArray type=\"Float64\" NumberOfComponents=\"3\" format=\"appended\" offset=\"0\"/>")
+        );
+
+        // decode the coordinates block (UInt64 byte count + raw little-endian f64)
+        let marker = b"<AppendedData encoding=\"raw\">\n_";
+        let start = contents
+            .windows(marker.len())
+            .position(|w| w == marker)
+            .ok_or("cannot find appended data")?
+            + marker.len();
+        let nbyte = u64::from_le_bytes(contents[start..start + 8].try_into().unwrap()) as usize;
+        assert_eq!(nbyte, 3 * 3 * 8);
+        let mut coords = vec![0.0_f64; 9];
+        for i in 0..9 {
+            let a = start + 8 + i * 8;
+            coords[i] = f64::from_le_bytes(contents[a..a + 8].try_into().unwrap());
+        }
+        assert_eq!(coords, &[0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0, 0.0]);
+        Ok(())
+    }
+
+    #[test]
+    fn trigen_write_vtu_binary_f32() -> Result<(), StrError> {
+        let mut trigen = Trigen::new(3, None, None, None)?;
+        trigen
+            .set_point(0, 0, 0.25, 0.0)?
+            .set_point(1, 0, 1.0, 0.0)?
+            .set_point(2, 0, 0.0, 1.0)?;
+        trigen.generate_delaunay(false)?;
+        let file_path = "/tmp/tritet/test_trigen_write_vtu_binary_f32.vtu";
+        trigen.write_vtu_binary_with(file_path, true)?;
+        let contents = fs::read(file_path).map_err(|_| "cannot open file")?;
+
+        // the header references an f32 coordinates block
+        let header = String::from_utf8_lossy(&contents[..contents.len().min(2048)]).to_string();
+        assert!(
+            header.contains("<DataArray type=\"Float32\" NumberOfComponents=\"3\" format=\"appended\" offset=\"0\"/>")
+        );
+
+        // decode the coordinates block (UInt64 byte count + raw little-endian f32)
+        let marker = b"<AppendedData encoding=\"raw\">\n_";
+        let start = contents
+            .windows(marker.len())
+            .position(|w| w == marker)
+            .ok_or("cannot find appended data")?
+            + marker.len();
+        let nbyte = u64::from_le_bytes(contents[start..start + 8].try_into().unwrap()) as usize;
+        assert_eq!(nbyte, 3 * 3 * 4);
+        let mut coords = vec![0.0_f32; 9];
+        for i in 0..9 {
+            let a = start + 8 + i * 4;
+            coords[i] = f32::from_le_bytes(contents[a..a + 4].try_into().unwrap());
+        }
+        assert_eq!(coords, &[0.25, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0, 0.0]);
+        Ok(())
+    }
+
     #[test]
     fn trigen_write_vtu() -> Result<(), StrError> {
         let mut trigen = Trigen::new(3, None, None, None)?;